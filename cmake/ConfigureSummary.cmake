@@ -71,6 +71,12 @@ function( NEST_PRINT_CONFIG_SUMMARY )
     message( "Use threading       : No" )
   endif ()
 
+  if ( HAVE_OFFLOAD )
+    message( "Use offloading      : Yes (${with-offload})" )
+  else ()
+    message( "Use offloading      : No" )
+  endif ()
+
   if ( HAVE_GSL )
     message( "Use GSL             : Yes (GSL ${GSL_VERSION})" )
     message( "    Includes        : ${GSL_INCLUDE_DIRS}" )
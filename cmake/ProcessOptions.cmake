@@ -463,6 +463,23 @@ function( NEST_PROCESS_WITH_OPENMP )
 
 endfunction()
 
+function( NEST_PROCESS_WITH_OFFLOAD )
+  # Offloading uses OpenMP target directives, which fall back to the
+  # host if no device is available or OMP_TARGET_OFFLOAD=DISABLED
+  set( HAVE_OFFLOAD OFF PARENT_SCOPE )
+  if ( with-offload )
+    if ( NOT OPENMP_FOUND )
+      message( FATAL_ERROR "Offloading requires OpenMP. Please set -Dwith-openmp=ON." )
+    endif ()
+    set( HAVE_OFFLOAD ON PARENT_SCOPE )
+    if ( NOT "${with-offload}" STREQUAL "ON" )
+      message( STATUS "Set offload flags: ${with-offload}" )
+      set( CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${with-offload}" PARENT_SCOPE )
+      set( CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${with-offload}" PARENT_SCOPE )
+    endif ()
+  endif ()
+endfunction()
+
 function( NEST_PROCESS_WITH_MPI )
   # Find MPI
   set( HAVE_MPI OFF PARENT_SCOPE )
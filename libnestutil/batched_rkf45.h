@@ -0,0 +1,412 @@
+/*
+ *  batched_rkf45.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BATCHED_RKF45_H
+#define BATCHED_RKF45_H
+
+// C++ includes:
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Embedded Runge-Kutta-Fehlberg (4, 5) solver that advances many
+ * instances (lanes) of one system of ODEs together.
+ *
+ * Each lane follows the integration of gsl_odeiv_evolve_apply() with
+ * gsl_odeiv_step_rkf45 and the standard step-size control of GSL
+ * (gsl_odeiv_control_standard_new()), that is, every lane has its own
+ * adaptive step size and error control. Lanes attempt their steps in
+ * lock-step; a lane that rejects its step repeats it with a smaller
+ * step in the next attempt, and a lane that has reached the end of the
+ * interval is masked until all lanes are done.
+ *
+ * The state of all lanes is a structure of arrays: component k of lane
+ * i is y[ k * num_lanes + i ]. The system is a function object called as
+ * sys( y, f ), which stores the derivatives of all lanes at y in f, in
+ * the same layout.
+ *
+ * Usage:
+ * @code
+ * solver.begin( step );
+ * while ( solver.attempt( sys, y, h, eps_abs, eps_rel ) )
+ * {
+ *   // handle lanes i with solver.accepted( i )
+ * }
+ * @endcode
+ */
+class BatchedRKF45
+{
+public:
+  BatchedRKF45();
+
+  /**
+   * Prepare the solver for num_lanes instances of a system of dimension
+   * dim, with the step-size control of gsl_odeiv_control_standard_new(
+   * eps_abs, eps_rel, a_y, a_dydt ); the tolerances are given per lane
+   * to attempt().
+   */
+  void init( const size_t dim, const size_t num_lanes, const double a_y, const double a_dydt );
+
+  //! Start the integration of all lanes over (0, t_end]
+  void begin( const double t_end );
+
+  /**
+   * Attempt one step on all lanes that have not reached the end of the
+   * interval.
+   *
+   * @param sys     system of ODEs
+   * @param y       state of all lanes, updated for lanes accepting their step
+   * @param h       step size of each lane, adapted as by gsl_odeiv_evolve_apply()
+   * @param eps_abs absolute error tolerance of each lane
+   * @param eps_rel relative error tolerance of each lane
+   * @returns false if all lanes had already reached the end of the interval
+   */
+  template < typename System >
+  bool attempt( System& sys, double* y, double* h, const double* eps_abs, const double* eps_rel );
+
+  //! Whether lane i accepted its step in the last attempt
+  bool accepted( const size_t i ) const;
+
+private:
+  //! Returns component k of the workspace array with index a
+  double* get_workspace_( const size_t a, const size_t k = 0 );
+
+  //! Arrays of the workspace, each holding dim_ components of all lanes
+  enum WorkspaceArrays_
+  {
+    K1 = 0,
+    K2,
+    K3,
+    K4,
+    K5,
+    K6,
+    Y_TMP,
+    Y_NEW,
+    Y_ERR,
+    DYDT_OUT,
+    NUM_WORKSPACE_ARRAYS
+  };
+
+  size_t dim_;
+  size_t num_lanes_;
+  double a_y_;
+  double a_dydt_;
+  double t_end_;
+
+  std::vector< double > workspace_;
+  std::vector< double > t_;         //!< time reached by each lane
+  std::vector< double > h0_;        //!< step attempted by each lane
+  std::vector< double > r_max_;     //!< maximal ratio of error and tolerance of each lane
+  std::vector< char > final_step_;  //!< whether the step of a lane ends at t_end
+  std::vector< char > retry_;       //!< whether a lane repeats its rejected step
+  std::vector< char > accepted_;    //!< whether the step of a lane was accepted
+  std::vector< char > active_;      //!< whether a lane has not reached t_end
+};
+
+inline BatchedRKF45::BatchedRKF45()
+  : dim_( 0 )
+  , num_lanes_( 0 )
+  , a_y_( 1.0 )
+  , a_dydt_( 0.0 )
+  , t_end_( 0.0 )
+{
+}
+
+inline void
+BatchedRKF45::init( const size_t dim, const size_t num_lanes, const double a_y, const double a_dydt )
+{
+  dim_ = dim;
+  num_lanes_ = num_lanes;
+  a_y_ = a_y;
+  a_dydt_ = a_dydt;
+
+  workspace_.assign( NUM_WORKSPACE_ARRAYS * dim_ * num_lanes_, 0.0 );
+  t_.assign( num_lanes_, 0.0 );
+  h0_.assign( num_lanes_, 0.0 );
+  r_max_.assign( num_lanes_, 0.0 );
+  final_step_.assign( num_lanes_, 0 );
+  retry_.assign( num_lanes_, 0 );
+  accepted_.assign( num_lanes_, 0 );
+  active_.assign( num_lanes_, 0 );
+}
+
+inline void
+BatchedRKF45::begin( const double t_end )
+{
+  t_end_ = t_end;
+  t_.assign( num_lanes_, 0.0 );
+  retry_.assign( num_lanes_, 0 );
+  accepted_.assign( num_lanes_, 0 );
+}
+
+inline bool
+BatchedRKF45::accepted( const size_t i ) const
+{
+  return accepted_[ i ];
+}
+
+inline double*
+BatchedRKF45::get_workspace_( const size_t a, const size_t k )
+{
+  return &workspace_[ ( a * dim_ + k ) * num_lanes_ ];
+}
+
+template < typename System >
+bool
+BatchedRKF45::attempt( System& sys, double* y, double* h, const double* eps_abs, const double* eps_rel )
+{
+  // Coefficients of gsl_odeiv_step_rkf45
+  const double ah[] = { 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+  const double b3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+  const double b4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+  const double b5[] = { 8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0 };
+  const double b6[] = { -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0, 9295.0 / 20520.0, -5643.0 / 20520.0 };
+  const double c1 = 902880.0 / 7618050.0;
+  const double c3 = 3953664.0 / 7618050.0;
+  const double c4 = 3855735.0 / 7618050.0;
+  const double c5 = -1371249.0 / 7618050.0;
+  const double c6 = 277020.0 / 7618050.0;
+  const double ec[] = { 0.0, 1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0, 2.0 / 55.0 };
+  // order of the method and safety factor of the step-size control
+  const double order = 5.0;
+  const double S = 0.9;
+
+  const size_t n = num_lanes_;
+
+  bool any_active = false;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    // A lane that rejected its step repeats it with the reduced step in
+    // h0_, other lanes start a new step; both are bounded by the end of
+    // the interval.
+    active_[ i ] = t_[ i ] < t_end_;
+    if ( active_[ i ] )
+    {
+      const double dt = t_end_ - t_[ i ];
+      const double h_try = retry_[ i ] ? h0_[ i ] : h[ i ];
+      final_step_[ i ] = h_try > dt;
+      h0_[ i ] = final_step_[ i ] ? dt : h_try;
+    }
+    any_active = any_active or active_[ i ];
+  }
+  if ( not any_active )
+  {
+    return false;
+  }
+
+  double* const k1 = get_workspace_( K1 );
+  double* const k2 = get_workspace_( K2 );
+  double* const k3 = get_workspace_( K3 );
+  double* const k4 = get_workspace_( K4 );
+  double* const k5 = get_workspace_( K5 );
+  double* const k6 = get_workspace_( K6 );
+  double* const y_tmp = get_workspace_( Y_TMP );
+  double* const y_new = get_workspace_( Y_NEW );
+  double* const y_err = get_workspace_( Y_ERR );
+  double* const dydt_out = get_workspace_( DYDT_OUT );
+  const double* const h0 = &h0_[ 0 ];
+
+  // Inactive lanes are computed with a step of zero and discarded, such
+  // that all loops over lanes run without branches.
+  for ( size_t i = 0; i < n; ++i )
+  {
+    h0_[ i ] = active_[ i ] ? h0_[ i ] : 0.0;
+  }
+
+  sys( y, k1 );
+
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      y_tmp[ o + i ] = y[ o + i ] + ah[ 0 ] * h0[ i ] * k1[ o + i ];
+    }
+  }
+  sys( y_tmp, k2 );
+
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      y_tmp[ o + i ] = y[ o + i ] + h0[ i ] * ( b3[ 0 ] * k1[ o + i ] + b3[ 1 ] * k2[ o + i ] );
+    }
+  }
+  sys( y_tmp, k3 );
+
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      y_tmp[ o + i ] =
+        y[ o + i ] + h0[ i ] * ( b4[ 0 ] * k1[ o + i ] + b4[ 1 ] * k2[ o + i ] + b4[ 2 ] * k3[ o + i ] );
+    }
+  }
+  sys( y_tmp, k4 );
+
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      y_tmp[ o + i ] = y[ o + i ]
+        + h0[ i ] * ( b5[ 0 ] * k1[ o + i ] + b5[ 1 ] * k2[ o + i ] + b5[ 2 ] * k3[ o + i ] + b5[ 3 ] * k4[ o + i ] );
+    }
+  }
+  sys( y_tmp, k5 );
+
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      y_tmp[ o + i ] = y[ o + i ]
+        + h0[ i ] * ( b6[ 0 ] * k1[ o + i ] + b6[ 1 ] * k2[ o + i ] + b6[ 2 ] * k3[ o + i ] + b6[ 3 ] * k4[ o + i ]
+                      + b6[ 4 ] * k5[ o + i ] );
+    }
+  }
+  sys( y_tmp, k6 );
+
+  // fifth-order solution and its difference to the fourth-order solution
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const size_t o = k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double d_i =
+        c1 * k1[ o + i ] + c3 * k3[ o + i ] + c4 * k4[ o + i ] + c5 * k5[ o + i ] + c6 * k6[ o + i ];
+      y_new[ o + i ] = y[ o + i ] + h0[ i ] * d_i;
+      y_err[ o + i ] = h0[ i ]
+        * ( ec[ 1 ] * k1[ o + i ] + ec[ 3 ] * k3[ o + i ] + ec[ 4 ] * k4[ o + i ] + ec[ 5 ] * k5[ o + i ]
+                         + ec[ 6 ] * k6[ o + i ] );
+    }
+  }
+
+  // the derivatives at the end of the step are only used to control the
+  // error if the tolerance depends on them
+  if ( a_dydt_ != 0.0 )
+  {
+    sys( y_new, dydt_out );
+  }
+
+  // maximal ratio of error and tolerance over the components of each lane
+  for ( size_t i = 0; i < n; ++i )
+  {
+    r_max_[ i ] = DBL_MIN;
+  }
+  for ( size_t k = 0; k < dim_; ++k )
+  {
+    const double* const y_new_k = y_new + k * n;
+    const double* const y_err_k = y_err + k * n;
+    const double* const dydt_out_k = dydt_out + k * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double y_scale = a_y_ * std::fabs( y_new_k[ i ] ) + a_dydt_ * std::fabs( h0[ i ] * dydt_out_k[ i ] );
+      const double D0 = eps_rel[ i ] * y_scale + eps_abs[ i ];
+      const double r = std::fabs( y_err_k[ i ] ) / std::fabs( D0 );
+      r_max_[ i ] = r > r_max_[ i ] ? r : r_max_[ i ];
+    }
+  }
+
+  // Adjust the step sizes as gsl_odeiv_control_hadjust() and accept or
+  // reject the steps as gsl_odeiv_evolve_apply().
+  for ( size_t i = 0; i < n; ++i )
+  {
+    if ( not active_[ i ] )
+    {
+      accepted_[ i ] = false;
+      continue;
+    }
+
+    const double h_old = h0_[ i ];
+    const double t_next = final_step_[ i ] ? t_end_ : t_[ i ] + h_old;
+    double h_new = h_old;
+    if ( r_max_[ i ] > 1.1 )
+    {
+      // decrease step, no more than factor of 5, but a fraction S more
+      // than scaling suggests
+      const double r = std::max( S / std::pow( r_max_[ i ], 1.0 / order ), 0.2 );
+      h_new = r * h_old;
+
+      // repeat the step if the step size actually decreased and changes
+      // the time by at least 1 ulp
+      if ( std::fabs( h_new ) < std::fabs( h_old ) and t_next + h_new != t_next )
+      {
+        h0_[ i ] = h_new;
+        retry_[ i ] = true;
+        accepted_[ i ] = false;
+        continue;
+      }
+      h_new = h_old;
+    }
+    else if ( r_max_[ i ] < 0.5 )
+    {
+      // increase step, no more than factor of 5
+      const double r = std::min( std::max( S / std::pow( r_max_[ i ], 1.0 / ( order + 1.0 ) ), 1.0 ), 5.0 );
+      h_new = r * h_old;
+    }
+
+    t_[ i ] = t_next;
+    h[ i ] = h_new;
+    retry_[ i ] = false;
+    accepted_[ i ] = true;
+    for ( size_t k = 0; k < dim_; ++k )
+    {
+      y[ k * n + i ] = y_new[ k * n + i ];
+    }
+  }
+
+  return true;
+}
+
+} // namespace nest
+
+#endif /* BATCHED_RKF45_H */
@@ -0,0 +1,194 @@
+/*
+ *  interned.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INTERNED_H
+#define INTERNED_H
+
+// C++ includes:
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+
+namespace nest
+{
+
+//! Hash of no values
+inline size_t
+hash_values()
+{
+  return 0;
+}
+
+/**
+ * Combined hash of the given values, to implement the hash() of types
+ * held by Interned.
+ */
+template < typename T, typename... Ts >
+size_t
+hash_values( const T& value, const Ts&... values )
+{
+  const size_t seed = hash_values( values... );
+  return seed ^ ( std::hash< T >()( value ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ) );
+}
+
+/**
+ * Immutable value of type T that is shared by all objects holding an
+ * equal value.
+ *
+ * Assigning a value looks it up in a pool of all values of type T that
+ * are in use and shares the existing instance if there is one, such
+ * that, e.g., the neurons of a population with identical parameters
+ * hold a single copy of them. Objects holding the same instance can be
+ * recognized by comparing get().
+ *
+ * T must be copy-constructible and provide operator==() and a member
+ * function size_t hash() const. Values are looked up in a critical
+ * section, such that they can be assigned by all threads, but should
+ * not be assigned in the update of nodes.
+ */
+template < typename T >
+class Interned
+{
+public:
+  //! Holds no value until one is assigned
+  Interned();
+
+  Interned( const T& value );
+
+  Interned& operator=( const T& value );
+
+  const T& operator*() const;
+  const T* operator->() const;
+
+  //! Returns the shared instance, or nullptr if no value was assigned
+  const T* get() const;
+
+private:
+  typedef std::unordered_multimap< size_t, std::weak_ptr< const T > > Pool_;
+
+  //! Returns the instance in the pool that equals value, adding it if there is none
+  static std::shared_ptr< const T > intern_( const T& value );
+
+  std::shared_ptr< const T > value_;
+};
+
+template < typename T >
+inline Interned< T >::Interned()
+  : value_()
+{
+}
+
+template < typename T >
+inline Interned< T >::Interned( const T& value )
+  : value_( intern_( value ) )
+{
+}
+
+template < typename T >
+inline Interned< T >&
+Interned< T >::operator=( const T& value )
+{
+  value_ = intern_( value );
+  return *this;
+}
+
+template < typename T >
+inline const T& Interned< T >::operator*() const
+{
+  assert( value_ );
+  return *value_;
+}
+
+template < typename T >
+inline const T* Interned< T >::operator->() const
+{
+  assert( value_ );
+  return value_.get();
+}
+
+template < typename T >
+inline const T*
+Interned< T >::get() const
+{
+  return value_.get();
+}
+
+template < typename T >
+std::shared_ptr< const T >
+Interned< T >::intern_( const T& value )
+{
+  static Pool_ pool;
+  static size_t swept_size = 0; // size of the pool after the last sweep
+
+  const size_t hash = value.hash();
+  std::shared_ptr< const T > instance;
+
+#pragma omp critical( interned )
+  {
+    // look up the value and drop expired instances of the same hash
+    const auto range = pool.equal_range( hash );
+    for ( auto it = range.first; it != range.second and not instance; )
+    {
+      std::shared_ptr< const T > candidate = it->second.lock();
+      if ( not candidate )
+      {
+        it = pool.erase( it );
+      }
+      else
+      {
+        if ( *candidate == value )
+        {
+          instance = candidate;
+        }
+        ++it;
+      }
+    }
+
+    if ( not instance )
+    {
+      // not allocated by make_shared, such that memory is released when
+      // the last holder is gone, not when the pool drops its entry
+      instance = std::shared_ptr< const T >( new T( value ) );
+      pool.insert( std::make_pair( hash, std::weak_ptr< const T >( instance ) ) );
+
+      // drop all expired instances once the pool has doubled, which
+      // keeps its size proportional to the number of values in use
+      if ( pool.size() > 2 * swept_size )
+      {
+        for ( auto it = pool.begin(); it != pool.end(); )
+        {
+          it = it->second.expired() ? pool.erase( it ) : std::next( it );
+        }
+        swept_size = pool.size();
+      }
+    }
+  }
+
+  return instance;
+}
+
+} // namespace nest
+
+#endif /* INTERNED_H */
@@ -25,6 +25,7 @@
 #ifdef HAVE_GSL
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <iomanip>
@@ -39,6 +40,7 @@
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_names.h"
+#include "node_block.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -145,6 +147,7 @@ nest::aeif_cond_alpha::Parameters_::Parameters_()
   , tau_syn_in( 2.0 ) // ms
   , I_e( 0.0 )        // pA
   , gsl_error_tol( 1e-6 )
+  , batched_solver( false )
 {
 }
 
@@ -202,6 +205,7 @@ nest::aeif_cond_alpha::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::I_e, I_e );
   def< double >( d, names::V_peak, V_peak_ );
   def< double >( d, names::gsl_error_tol, gsl_error_tol );
+  def< bool >( d, names::batched_solver, batched_solver );
 }
 
 void
@@ -229,6 +233,7 @@ nest::aeif_cond_alpha::Parameters_::set( const DictionaryDatum& d, Node* node )
   updateValueParam< double >( d, names::I_e, I_e, node );
 
   updateValueParam< double >( d, names::gsl_error_tol, gsl_error_tol, node );
+  updateValueParam< bool >( d, names::batched_solver, batched_solver, node );
 
   if ( V_reset_ >= V_peak_ )
   {
@@ -538,6 +543,293 @@ nest::aeif_cond_alpha::update( Time const& origin, const long from, const long t
   }
 }
 
+/* ----------------------------------------------------------------
+ * Population update with the batched solver
+ * ---------------------------------------------------------------- */
+
+class nest::aeif_cond_alpha::PopulationDynamics_
+{
+public:
+  explicit PopulationDynamics_( NodeBlock& block );
+
+  /**
+   * Stores the derivatives of the states y of all neurons in f, as
+   * aeif_cond_alpha_dynamics() does for a single neuron.
+   */
+  void operator()( const double* y, double* f ) const;
+
+private:
+  const size_t n_;
+  const double* const r_;
+  const double* const I_stim_;
+  const double* const V_peak_;
+  const double* const V_reset_;
+  const double* const g_L_;
+  const double* const C_m_;
+  const double* const E_ex_;
+  const double* const E_in_;
+  const double* const E_L_;
+  const double* const Delta_T_;
+  const double* const tau_w_;
+  const double* const a_;
+  const double* const V_th_;
+  const double* const tau_syn_ex_;
+  const double* const tau_syn_in_;
+  const double* const I_e_;
+};
+
+nest::aeif_cond_alpha::PopulationDynamics_::PopulationDynamics_( NodeBlock& block )
+  : n_( block.nodes.size() )
+  , r_( block.get_array( POP_R ) )
+  , I_stim_( block.get_array( POP_I_STIM ) )
+  , V_peak_( block.get_array( POP_V_PEAK ) )
+  , V_reset_( block.get_array( POP_V_RESET ) )
+  , g_L_( block.get_array( POP_G_L ) )
+  , C_m_( block.get_array( POP_C_M ) )
+  , E_ex_( block.get_array( POP_E_EX ) )
+  , E_in_( block.get_array( POP_E_IN ) )
+  , E_L_( block.get_array( POP_E_L ) )
+  , Delta_T_( block.get_array( POP_DELTA_T ) )
+  , tau_w_( block.get_array( POP_TAU_W ) )
+  , a_( block.get_array( POP_A ) )
+  , V_th_( block.get_array( POP_V_TH ) )
+  , tau_syn_ex_( block.get_array( POP_TAU_SYN_EX ) )
+  , tau_syn_in_( block.get_array( POP_TAU_SYN_IN ) )
+  , I_e_( block.get_array( POP_I_E ) )
+{
+}
+
+void
+nest::aeif_cond_alpha::PopulationDynamics_::operator()( const double* y, double* f ) const
+{
+  typedef nest::aeif_cond_alpha::State_ S;
+
+  const double* const V_m = y + S::V_M * n_;
+  const double* const dg_ex = y + S::DG_EXC * n_;
+  const double* const g_ex = y + S::G_EXC * n_;
+  const double* const dg_in = y + S::DG_INH * n_;
+  const double* const g_in = y + S::G_INH * n_;
+  const double* const w = y + S::W * n_;
+
+  double* const f_V_m = f + S::V_M * n_;
+  double* const f_dg_ex = f + S::DG_EXC * n_;
+  double* const f_g_ex = f + S::G_EXC * n_;
+  double* const f_dg_in = f + S::DG_INH * n_;
+  double* const f_g_in = f + S::G_INH * n_;
+  double* const f_w = f + S::W * n_;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for ( size_t i = 0; i < n_; ++i )
+  {
+    const bool is_refractory = r_[ i ] > 0;
+
+    const double V = is_refractory ? V_reset_[ i ] : std::min( V_m[ i ], V_peak_[ i ] );
+
+    const double I_syn_exc = g_ex[ i ] * ( V - E_ex_[ i ] );
+    const double I_syn_inh = g_in[ i ] * ( V - E_in_[ i ] );
+
+    const double I_spike =
+      Delta_T_[ i ] == 0. ? 0. : ( g_L_[ i ] * Delta_T_[ i ] * std::exp( ( V - V_th_[ i ] ) / Delta_T_[ i ] ) );
+
+    f_V_m[ i ] = is_refractory
+      ? 0.
+      : ( -g_L_[ i ] * ( V - E_L_[ i ] ) + I_spike - I_syn_exc - I_syn_inh - w[ i ] + I_e_[ i ] + I_stim_[ i ] )
+        / C_m_[ i ];
+
+    f_dg_ex[ i ] = -dg_ex[ i ] / tau_syn_ex_[ i ];
+    f_g_ex[ i ] = dg_ex[ i ] - g_ex[ i ] / tau_syn_ex_[ i ];
+
+    f_dg_in[ i ] = -dg_in[ i ] / tau_syn_in_[ i ];
+    f_g_in[ i ] = dg_in[ i ] - g_in[ i ] / tau_syn_in_[ i ];
+
+    f_w[ i ] = ( a_[ i ] * ( V - E_L_[ i ] ) - w[ i ] ) / tau_w_[ i ];
+  }
+}
+
+bool
+nest::aeif_cond_alpha::supports_population_update() const
+{
+  return P_.batched_solver;
+}
+
+void
+nest::aeif_cond_alpha::init_population( NodeBlock& block )
+{
+  block.resize_arrays( NUM_POP_ARRAYS );
+  block.logged.clear();
+
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    const aeif_cond_alpha& neuron = *static_cast< aeif_cond_alpha* >( block.nodes[ i ] );
+
+    for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+    {
+      block.get_array( POP_V_M + k )[ i ] = neuron.S_.y_[ k ];
+    }
+    block.get_array( POP_R )[ i ] = neuron.S_.r_;
+    block.get_array( POP_INTEGRATION_STEP )[ i ] = neuron.B_.IntegrationStep_;
+    block.get_array( POP_I_STIM )[ i ] = neuron.B_.I_stim_;
+
+    block.get_array( POP_GSL_ERROR_TOL )[ i ] = neuron.P_.gsl_error_tol;
+    block.get_array( POP_V_PEAK )[ i ] = neuron.P_.V_peak_;
+    block.get_array( POP_V_RESET )[ i ] = neuron.P_.V_reset_;
+    block.get_array( POP_G_L )[ i ] = neuron.P_.g_L;
+    block.get_array( POP_C_M )[ i ] = neuron.P_.C_m;
+    block.get_array( POP_E_EX )[ i ] = neuron.P_.E_ex;
+    block.get_array( POP_E_IN )[ i ] = neuron.P_.E_in;
+    block.get_array( POP_E_L )[ i ] = neuron.P_.E_L;
+    block.get_array( POP_DELTA_T )[ i ] = neuron.P_.Delta_T;
+    block.get_array( POP_TAU_W )[ i ] = neuron.P_.tau_w;
+    block.get_array( POP_A )[ i ] = neuron.P_.a;
+    block.get_array( POP_B )[ i ] = neuron.P_.b;
+    block.get_array( POP_V_TH )[ i ] = neuron.P_.V_th;
+    block.get_array( POP_TAU_SYN_EX )[ i ] = neuron.P_.tau_syn_ex;
+    block.get_array( POP_TAU_SYN_IN )[ i ] = neuron.P_.tau_syn_in;
+    block.get_array( POP_I_E )[ i ] = neuron.P_.I_e;
+
+    block.get_array( POP_G0_EX )[ i ] = neuron.V_.g0_ex_;
+    block.get_array( POP_G0_IN )[ i ] = neuron.V_.g0_in_;
+    block.get_array( POP_SPIKE_THRESHOLD )[ i ] = neuron.V_.V_peak;
+    block.get_array( POP_REFRACTORY_COUNTS )[ i ] = neuron.V_.refractory_counts_;
+
+    if ( neuron.B_.logger_.has_loggers() )
+    {
+      block.logged.push_back( i );
+    }
+  }
+
+  // same step-size control as gsl_odeiv_control_yp_new() in init_buffers_()
+  B_.solver_.init( State_::STATE_VEC_SIZE, block.nodes.size(), 0.0, 1.0 );
+}
+
+void
+nest::aeif_cond_alpha::update_population( NodeBlock& block, Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+  assert( State_::V_M == 0 );
+
+  const size_t n = block.nodes.size();
+
+  double* const y = block.get_array( POP_V_M ); // state vectors, advanced by the solver
+  double* const V_m = block.get_array( POP_V_M );
+  double* const dg_ex = block.get_array( POP_DG_EXC );
+  double* const dg_in = block.get_array( POP_DG_INH );
+  double* const w = block.get_array( POP_W );
+  double* const r = block.get_array( POP_R );
+  double* const h = block.get_array( POP_INTEGRATION_STEP );
+  double* const I_stim = block.get_array( POP_I_STIM );
+  const double* const gsl_error_tol = block.get_array( POP_GSL_ERROR_TOL );
+  const double* const V_reset = block.get_array( POP_V_RESET );
+  const double* const b = block.get_array( POP_B );
+  const double* const g0_ex = block.get_array( POP_G0_EX );
+  const double* const g0_in = block.get_array( POP_G0_IN );
+  const double* const spike_threshold = block.get_array( POP_SPIKE_THRESHOLD );
+  const double* const refractory_counts = block.get_array( POP_REFRACTORY_COUNTS );
+  double* const num_spikes = block.get_array( POP_NUM_SPIKES );
+
+  PopulationDynamics_ dynamics( block );
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    std::fill( num_spikes, num_spikes + n, 0. );
+
+    // Integrate all neurons over (0, step], each with its own adaptive
+    // step size as by gsl_odeiv_evolve_apply() in update(). After each
+    // accepted step of a neuron, its spikes are handled as in update().
+    B_.solver_.begin( B_.step_ );
+    while ( B_.solver_.attempt( dynamics, y, h, gsl_error_tol, gsl_error_tol ) )
+    {
+      for ( size_t i = 0; i < n; ++i )
+      {
+        if ( not B_.solver_.accepted( i ) )
+        {
+          continue;
+        }
+
+        // check for unreasonable values; we allow V_M to explode
+        if ( V_m[ i ] < -1e3 || w[ i ] < -1e6 || w[ i ] > 1e6 )
+        {
+          throw NumericalInstability( get_name() );
+        }
+
+        if ( r[ i ] > 0 )
+        {
+          V_m[ i ] = V_reset[ i ];
+        }
+        else if ( V_m[ i ] >= spike_threshold[ i ] )
+        {
+          V_m[ i ] = V_reset[ i ];
+          w[ i ] += b[ i ]; // spike-driven adaptation
+          r[ i ] = refractory_counts[ i ] > 0 ? refractory_counts[ i ] + 1 : 0;
+          num_spikes[ i ] += 1;
+        }
+      }
+    }
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      aeif_cond_alpha& neuron = *static_cast< aeif_cond_alpha* >( block.nodes[ i ] );
+
+      // decrement refractory count
+      if ( r[ i ] > 0 )
+      {
+        r[ i ] -= 1;
+      }
+
+      // apply spikes
+      dg_ex[ i ] += neuron.B_.spike_exc_.get_value( lag ) * g0_ex[ i ];
+      dg_in[ i ] += neuron.B_.spike_inh_.get_value( lag ) * g0_in[ i ];
+
+      // set new input current
+      I_stim[ i ] = neuron.B_.currents_.get_value( lag );
+    }
+
+    // emit the spikes of this step in the order of the neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      aeif_cond_alpha& neuron = *static_cast< aeif_cond_alpha* >( block.nodes[ i ] );
+      for ( int k = 0; k < num_spikes[ i ]; ++k )
+      {
+        neuron.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( neuron, se, lag );
+      }
+    }
+
+    // log state data of recorded neurons
+    for ( std::vector< index >::const_iterator it = block.logged.begin(); it != block.logged.end(); ++it )
+    {
+      aeif_cond_alpha& neuron = *static_cast< aeif_cond_alpha* >( block.nodes[ *it ] );
+      neuron.store_population_state_( block, *it );
+      neuron.B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+}
+
+void
+nest::aeif_cond_alpha::finalize_population( NodeBlock& block )
+{
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    static_cast< aeif_cond_alpha* >( block.nodes[ i ] )->store_population_state_( block, i );
+  }
+}
+
+void
+nest::aeif_cond_alpha::store_population_state_( NodeBlock& block, const index i )
+{
+  for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+  {
+    S_.y_[ k ] = block.get_array( POP_V_M + k )[ i ];
+  }
+  S_.r_ = block.get_array( POP_R )[ i ];
+  B_.IntegrationStep_ = block.get_array( POP_INTEGRATION_STEP )[ i ];
+  B_.I_stim_ = block.get_array( POP_I_STIM )[ i ];
+}
+
 void
 nest::aeif_cond_alpha::handle( SpikeEvent& e )
 {
@@ -33,6 +33,9 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_odeiv.h>
 
+// Includes from libnestutil:
+#include "batched_rkf45.h"
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
@@ -152,13 +155,18 @@ The following parameters can be set in the status dictionary.
                     (alpha function)
 =========== ======= ===========================================================
 
-============= ======= =========================================================
+============== ======= ========================================================
 **Integration parameters**
 -------------------------------------------------------------------------------
-gsl_error_tol real    This parameter controls the admissible error of the
-                      GSL integrator. Reduce it if NEST complains about
-                      numerical instabilities.
-============= ======= =========================================================
+gsl_error_tol  real    This parameter controls the admissible error of the
+                       GSL integrator. Reduce it if NEST complains about
+                       numerical instabilities.
+batched_solver boolean If true and the kernel updates populations
+                       (population_update), consecutive neurons that set
+                       it are integrated together by a batched
+                       Runge-Kutta-Fehlberg solver instead of GSL, with
+                       the same method and error control (default: false)
+============== ======= ========================================================
 
 Sends
 +++++
@@ -220,6 +228,11 @@ private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  bool supports_population_update() const;
+  void init_population( NodeBlock& );
+  void update_population( NodeBlock&, Time const&, const long, const long );
+  void finalize_population( NodeBlock& );
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
@@ -256,6 +269,7 @@ private:
     double I_e;        //!< Intrinsic current in pA
 
     double gsl_error_tol; //!< Error bound for GSL integrator
+    bool batched_solver;  //!< Integrate with the population update if possible
 
     Parameters_(); //!< Sets default parameter values
 
@@ -340,6 +354,9 @@ public:
      * the first simulation, but not modified before later Simulate calls.
      */
     double I_stim_;
+
+    //! Solver of the population update, used on the first neuron of a block
+    BatchedRKF45 solver_;
   };
 
   // ----------------------------------------------------------------
@@ -364,6 +381,55 @@ public:
     unsigned int refractory_counts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Arrays of the structure of arrays in which the population update
+   * keeps state, parameters and input of all neurons of a block, see
+   * update_population(). The first arrays hold the state vector in the
+   * order of State_::StateVecElems, which the batched solver advances.
+   */
+  enum PopulationArrays_
+  {
+    POP_V_M = 0,
+    POP_DG_EXC,
+    POP_G_EXC,
+    POP_DG_INH,
+    POP_G_INH,
+    POP_W,
+    POP_R,
+    POP_INTEGRATION_STEP,
+    POP_I_STIM,
+    POP_GSL_ERROR_TOL,
+    POP_V_PEAK,
+    POP_V_RESET,
+    POP_G_L,
+    POP_C_M,
+    POP_E_EX,
+    POP_E_IN,
+    POP_E_L,
+    POP_DELTA_T,
+    POP_TAU_W,
+    POP_A,
+    POP_B,
+    POP_V_TH,
+    POP_TAU_SYN_EX,
+    POP_TAU_SYN_IN,
+    POP_I_E,
+    POP_G0_EX,
+    POP_G0_IN,
+    POP_SPIKE_THRESHOLD,
+    POP_REFRACTORY_COUNTS,
+    POP_NUM_SPIKES,
+    NUM_POP_ARRAYS
+  };
+
+  //! Right-hand side of the ODEs of all neurons of a block, for the batched solver
+  class PopulationDynamics_;
+
+  //! Copy the state of this neuron, the i-th of the block, from the arrays
+  void store_population_state_( NodeBlock&, const index i );
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
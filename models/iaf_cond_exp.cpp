@@ -38,6 +38,7 @@
 #include "event.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "node_block.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -111,6 +112,7 @@ nest::iaf_cond_exp::Parameters_::Parameters_()
   , tau_synE( 0.2 )   // ms
   , tau_synI( 2.0 )   // ms
   , I_e( 0.0 )        // pA
+  , batched_solver( false )
 {
 }
 
@@ -159,6 +161,7 @@ nest::iaf_cond_exp::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::tau_syn_ex, tau_synE );
   def< double >( d, names::tau_syn_in, tau_synI );
   def< double >( d, names::I_e, I_e );
+  def< bool >( d, names::batched_solver, batched_solver );
 }
 
 void
@@ -180,6 +183,7 @@ nest::iaf_cond_exp::Parameters_::set( const DictionaryDatum& d, Node* node )
   updateValueParam< double >( d, names::tau_syn_in, tau_synI, node );
 
   updateValueParam< double >( d, names::I_e, I_e, node );
+  updateValueParam< bool >( d, names::batched_solver, batched_solver, node );
   if ( V_reset_ >= V_th_ )
   {
     throw BadProperty( "Reset potential must be smaller than threshold." );
@@ -416,6 +420,228 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Population update with the batched solver
+ * ---------------------------------------------------------------- */
+
+class nest::iaf_cond_exp::PopulationDynamics_
+{
+public:
+  explicit PopulationDynamics_( NodeBlock& block );
+
+  /**
+   * Stores the derivatives of the states y of all neurons in f, as
+   * iaf_cond_exp_dynamics() does for a single neuron.
+   */
+  void operator()( const double* y, double* f ) const;
+
+private:
+  const size_t n_;
+  const double* const I_stim_;
+  const double* const g_L_;
+  const double* const C_m_;
+  const double* const E_ex_;
+  const double* const E_in_;
+  const double* const E_L_;
+  const double* const tau_synE_;
+  const double* const tau_synI_;
+  const double* const I_e_;
+};
+
+nest::iaf_cond_exp::PopulationDynamics_::PopulationDynamics_( NodeBlock& block )
+  : n_( block.nodes.size() )
+  , I_stim_( block.get_array( POP_I_STIM ) )
+  , g_L_( block.get_array( POP_G_L ) )
+  , C_m_( block.get_array( POP_C_M ) )
+  , E_ex_( block.get_array( POP_E_EX ) )
+  , E_in_( block.get_array( POP_E_IN ) )
+  , E_L_( block.get_array( POP_E_L ) )
+  , tau_synE_( block.get_array( POP_TAU_SYN_E ) )
+  , tau_synI_( block.get_array( POP_TAU_SYN_I ) )
+  , I_e_( block.get_array( POP_I_E ) )
+{
+}
+
+void
+nest::iaf_cond_exp::PopulationDynamics_::operator()( const double* y, double* f ) const
+{
+  typedef nest::iaf_cond_exp::State_ S;
+
+  const double* const V_m = y + S::V_M * n_;
+  const double* const g_ex = y + S::G_EXC * n_;
+  const double* const g_in = y + S::G_INH * n_;
+
+  double* const f_V_m = f + S::V_M * n_;
+  double* const f_g_ex = f + S::G_EXC * n_;
+  double* const f_g_in = f + S::G_INH * n_;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for ( size_t i = 0; i < n_; ++i )
+  {
+    const double I_syn_exc = g_ex[ i ] * ( V_m[ i ] - E_ex_[ i ] );
+    const double I_syn_inh = g_in[ i ] * ( V_m[ i ] - E_in_[ i ] );
+    const double I_L = g_L_[ i ] * ( V_m[ i ] - E_L_[ i ] );
+
+    f_V_m[ i ] = ( -I_L + I_stim_[ i ] + I_e_[ i ] - I_syn_exc - I_syn_inh ) / C_m_[ i ];
+
+    f_g_ex[ i ] = -g_ex[ i ] / tau_synE_[ i ];
+    f_g_in[ i ] = -g_in[ i ] / tau_synI_[ i ];
+  }
+}
+
+bool
+nest::iaf_cond_exp::supports_population_update() const
+{
+  return P_.batched_solver;
+}
+
+void
+nest::iaf_cond_exp::init_population( NodeBlock& block )
+{
+  block.resize_arrays( NUM_POP_ARRAYS );
+  block.logged.clear();
+
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    const iaf_cond_exp& neuron = *static_cast< iaf_cond_exp* >( block.nodes[ i ] );
+
+    for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+    {
+      block.get_array( POP_V_M + k )[ i ] = neuron.S_.y_[ k ];
+    }
+    block.get_array( POP_R )[ i ] = neuron.S_.r_;
+    block.get_array( POP_INTEGRATION_STEP )[ i ] = neuron.B_.IntegrationStep_;
+    block.get_array( POP_I_STIM )[ i ] = neuron.B_.I_stim_;
+
+    // tolerances of gsl_odeiv_control_y_new() in init_buffers_()
+    block.get_array( POP_EPS_ABS )[ i ] = 1e-3;
+    block.get_array( POP_EPS_REL )[ i ] = 0.0;
+
+    block.get_array( POP_V_TH )[ i ] = neuron.P_.V_th_;
+    block.get_array( POP_V_RESET )[ i ] = neuron.P_.V_reset_;
+    block.get_array( POP_G_L )[ i ] = neuron.P_.g_L;
+    block.get_array( POP_C_M )[ i ] = neuron.P_.C_m;
+    block.get_array( POP_E_EX )[ i ] = neuron.P_.E_ex;
+    block.get_array( POP_E_IN )[ i ] = neuron.P_.E_in;
+    block.get_array( POP_E_L )[ i ] = neuron.P_.E_L;
+    block.get_array( POP_TAU_SYN_E )[ i ] = neuron.P_.tau_synE;
+    block.get_array( POP_TAU_SYN_I )[ i ] = neuron.P_.tau_synI;
+    block.get_array( POP_I_E )[ i ] = neuron.P_.I_e;
+
+    block.get_array( POP_REFRACTORY_COUNTS )[ i ] = neuron.V_.RefractoryCounts_;
+
+    if ( neuron.B_.logger_.has_loggers() )
+    {
+      block.logged.push_back( i );
+    }
+  }
+
+  B_.solver_.init( State_::STATE_VEC_SIZE, block.nodes.size(), 1.0, 0.0 );
+}
+
+void
+nest::iaf_cond_exp::update_population( NodeBlock& block, Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t n = block.nodes.size();
+
+  double* const y = block.get_array( POP_V_M ); // state vectors, advanced by the solver
+  double* const V_m = block.get_array( POP_V_M );
+  double* const g_ex = block.get_array( POP_G_EXC );
+  double* const g_in = block.get_array( POP_G_INH );
+  double* const r = block.get_array( POP_R );
+  double* const h = block.get_array( POP_INTEGRATION_STEP );
+  double* const I_stim = block.get_array( POP_I_STIM );
+  const double* const eps_abs = block.get_array( POP_EPS_ABS );
+  const double* const eps_rel = block.get_array( POP_EPS_REL );
+  const double* const V_th = block.get_array( POP_V_TH );
+  const double* const V_reset = block.get_array( POP_V_RESET );
+  const double* const RefractoryCounts = block.get_array( POP_REFRACTORY_COUNTS );
+  double* const spike = block.get_array( POP_SPIKE );
+
+  PopulationDynamics_ dynamics( block );
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // integrate all neurons over (0, step], each with its own adaptive
+    // step size as by gsl_odeiv_evolve_apply() in update()
+    B_.solver_.begin( B_.step_ );
+    while ( B_.solver_.attempt( dynamics, y, h, eps_abs, eps_rel ) )
+    {
+      // spikes are only detected at the end of the step
+    }
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      iaf_cond_exp& neuron = *static_cast< iaf_cond_exp* >( block.nodes[ i ] );
+
+      g_ex[ i ] += neuron.B_.spike_exc_.get_value( lag );
+      g_in[ i ] += neuron.B_.spike_inh_.get_value( lag );
+
+      spike[ i ] = 0.;
+      if ( r[ i ] != 0 )
+      { // neuron is absolute refractory
+        r[ i ] -= 1;
+        V_m[ i ] = V_reset[ i ];
+      }
+      else if ( V_m[ i ] >= V_th[ i ] )
+      {
+        r[ i ] = RefractoryCounts[ i ];
+        V_m[ i ] = V_reset[ i ];
+        spike[ i ] = 1.;
+      }
+
+      // set new input current
+      I_stim[ i ] = neuron.B_.currents_.get_value( lag );
+    }
+
+    // emit the spikes of this step in the order of the neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spike[ i ] != 0. )
+      {
+        iaf_cond_exp& neuron = *static_cast< iaf_cond_exp* >( block.nodes[ i ] );
+        neuron.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( neuron, se, lag );
+      }
+    }
+
+    // log state data of recorded neurons
+    for ( std::vector< index >::const_iterator it = block.logged.begin(); it != block.logged.end(); ++it )
+    {
+      iaf_cond_exp& neuron = *static_cast< iaf_cond_exp* >( block.nodes[ *it ] );
+      neuron.store_population_state_( block, *it );
+      neuron.B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+}
+
+void
+nest::iaf_cond_exp::finalize_population( NodeBlock& block )
+{
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    static_cast< iaf_cond_exp* >( block.nodes[ i ] )->store_population_state_( block, i );
+  }
+}
+
+void
+nest::iaf_cond_exp::store_population_state_( NodeBlock& block, const index i )
+{
+  for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+  {
+    S_.y_[ k ] = block.get_array( POP_V_M + k )[ i ];
+  }
+  S_.r_ = block.get_array( POP_R )[ i ];
+  B_.IntegrationStep_ = block.get_array( POP_INTEGRATION_STEP )[ i ];
+  B_.I_stim_ = block.get_array( POP_I_STIM )[ i ];
+}
+
 void
 nest::iaf_cond_exp::handle( SpikeEvent& e )
 {
@@ -33,6 +33,9 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_odeiv.h>
 
+// Includes from libnestutil:
+#include "batched_rkf45.h"
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
@@ -94,6 +97,14 @@ The following parameters can be set in the status dictionary.
  I_e        pA      Constant input current
 =========== ======  =======================================================
 
+============== ======= ========================================================
+batched_solver boolean If true and the kernel updates populations
+                       (population_update), consecutive neurons that set
+                       it are integrated together by a batched
+                       Runge-Kutta-Fehlberg solver instead of GSL, with
+                       the same method and error control (default: false)
+============== ======= ========================================================
+
 Sends
 +++++
 
@@ -155,6 +166,11 @@ private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  bool supports_population_update() const;
+  void init_population( NodeBlock& );
+  void update_population( NodeBlock&, Time const&, const long, const long );
+  void finalize_population( NodeBlock& );
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
@@ -184,6 +200,8 @@ private:
     double tau_synI; //!< Time constant for inhibitory synaptic kernel in ms
     double I_e;      //!< Constant Current in pA
 
+    bool batched_solver; //!< Integrate with the population update if possible
+
     Parameters_(); //!< Sets default parameter values
 
     void get( DictionaryDatum& ) const;             //!< Store current values in dictionary
@@ -260,6 +278,9 @@ private:
      * the first simulation, but not modified before later Simulate calls.
      */
     double I_stim_;
+
+    //! Solver of the population update, used on the first neuron of a block
+    BatchedRKF45 solver_;
   };
 
   // ----------------------------------------------------------------
@@ -272,6 +293,45 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Arrays of the structure of arrays in which the population update
+   * keeps state, parameters and input of all neurons of a block, see
+   * update_population(). The first arrays hold the state vector in the
+   * order of State_::StateVecElems, which the batched solver advances.
+   */
+  enum PopulationArrays_
+  {
+    POP_V_M = 0,
+    POP_G_EXC,
+    POP_G_INH,
+    POP_R,
+    POP_INTEGRATION_STEP,
+    POP_I_STIM,
+    POP_EPS_ABS,
+    POP_EPS_REL,
+    POP_V_TH,
+    POP_V_RESET,
+    POP_G_L,
+    POP_C_M,
+    POP_E_EX,
+    POP_E_IN,
+    POP_E_L,
+    POP_TAU_SYN_E,
+    POP_TAU_SYN_I,
+    POP_I_E,
+    POP_REFRACTORY_COUNTS,
+    POP_SPIKE,
+    NUM_POP_ARRAYS
+  };
+
+  //! Right-hand side of the ODEs of all neurons of a block, for the batched solver
+  class PopulationDynamics_;
+
+  //! Copy the state of this neuron, the i-th of the block, from the arrays
+  void store_population_state_( NodeBlock&, const index i );
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
@@ -23,7 +23,9 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
+#include <tuple>
 
 // Includes from libnestutil:
 #include "dict_util.h"
@@ -33,6 +35,7 @@
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "node_block.h"
 #include "ring_buffer_impl.h"
 #include "universal_data_logger_impl.h"
 
@@ -89,9 +92,82 @@ iaf_psc_alpha::State_::State_()
   , I_in_( 0.0 )
   , y3_( 0.0 )
   , r_( 0 )
+  , weighted_spikes_ex_( 0.0 )
+  , weighted_spikes_in_( 0.0 )
 {
 }
 
+bool
+iaf_psc_alpha::Parameters_::operator==( const Parameters_& p ) const
+{
+  return std::tie( Tau_, C_, TauR_, E_L_, I_e_, V_reset_, Theta_, LowerBound_, tau_ex_, tau_in_ )
+    == std::tie( p.Tau_, p.C_, p.TauR_, p.E_L_, p.I_e_, p.V_reset_, p.Theta_, p.LowerBound_, p.tau_ex_, p.tau_in_ );
+}
+
+size_t
+iaf_psc_alpha::Parameters_::hash() const
+{
+  return hash_values( Tau_, C_, TauR_, E_L_, I_e_, V_reset_, Theta_, LowerBound_, tau_ex_, tau_in_ );
+}
+
+bool
+iaf_psc_alpha::Variables_::operator==( const Variables_& v ) const
+{
+  return std::tie( EPSCInitialValue_,
+           IPSCInitialValue_,
+           RefractoryCounts_,
+           P11_ex_,
+           P21_ex_,
+           P22_ex_,
+           P31_ex_,
+           P32_ex_,
+           P11_in_,
+           P21_in_,
+           P22_in_,
+           P31_in_,
+           P32_in_,
+           P30_,
+           P33_,
+           expm1_tau_m_ )
+    == std::tie( v.EPSCInitialValue_,
+      v.IPSCInitialValue_,
+      v.RefractoryCounts_,
+      v.P11_ex_,
+      v.P21_ex_,
+      v.P22_ex_,
+      v.P31_ex_,
+      v.P32_ex_,
+      v.P11_in_,
+      v.P21_in_,
+      v.P22_in_,
+      v.P31_in_,
+      v.P32_in_,
+      v.P30_,
+      v.P33_,
+      v.expm1_tau_m_ );
+}
+
+size_t
+iaf_psc_alpha::Variables_::hash() const
+{
+  return hash_values( EPSCInitialValue_,
+    IPSCInitialValue_,
+    RefractoryCounts_,
+    P11_ex_,
+    P21_ex_,
+    P22_ex_,
+    P31_ex_,
+    P32_ex_,
+    P11_in_,
+    P21_in_,
+    P22_in_,
+    P31_in_,
+    P32_in_,
+    P30_,
+    P33_,
+    expm1_tau_m_ );
+}
+
 /* ----------------------------------------------------------------
  * Parameter and state extractions and manipulation functions
  * ---------------------------------------------------------------- */
@@ -217,7 +293,7 @@ iaf_psc_alpha::Buffers_::Buffers_( const Buffers_&, iaf_psc_alpha& n )
 
 iaf_psc_alpha::iaf_psc_alpha()
   : ArchivingNode()
-  , P_()
+  , P_( Parameters_() )
   , S_()
   , B_( *this )
 {
@@ -268,27 +344,29 @@ iaf_psc_alpha::calibrate()
 
   const double h = Time::get_resolution().get_ms();
 
+  Variables_ V;
+
   // these P are independent
-  V_.P11_ex_ = V_.P22_ex_ = std::exp( -h / P_.tau_ex_ );
-  V_.P11_in_ = V_.P22_in_ = std::exp( -h / P_.tau_in_ );
+  V.P11_ex_ = V.P22_ex_ = std::exp( -h / P_->tau_ex_ );
+  V.P11_in_ = V.P22_in_ = std::exp( -h / P_->tau_in_ );
 
-  V_.P33_ = std::exp( -h / P_.Tau_ );
+  V.P33_ = std::exp( -h / P_->Tau_ );
 
-  V_.expm1_tau_m_ = numerics::expm1( -h / P_.Tau_ );
+  V.expm1_tau_m_ = numerics::expm1( -h / P_->Tau_ );
 
   // these depend on the above. Please do not change the order.
-  V_.P30_ = -P_.Tau_ / P_.C_ * numerics::expm1( -h / P_.Tau_ );
-  V_.P21_ex_ = h * V_.P11_ex_;
-  V_.P21_in_ = h * V_.P11_in_;
+  V.P30_ = -P_->Tau_ / P_->C_ * numerics::expm1( -h / P_->Tau_ );
+  V.P21_ex_ = h * V.P11_ex_;
+  V.P21_in_ = h * V.P11_in_;
 
   // these are determined according to a numeric stability criterion
-  V_.P31_ex_ = propagator_31( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P32_ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P31_in_ = propagator_31( P_.tau_in_, P_.Tau_, P_.C_, h );
-  V_.P32_in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
+  V.P31_ex_ = propagator_31( P_->tau_ex_, P_->Tau_, P_->C_, h );
+  V.P32_ex_ = propagator_32( P_->tau_ex_, P_->Tau_, P_->C_, h );
+  V.P31_in_ = propagator_31( P_->tau_in_, P_->Tau_, P_->C_, h );
+  V.P32_in_ = propagator_32( P_->tau_in_, P_->Tau_, P_->C_, h );
 
-  V_.EPSCInitialValue_ = 1.0 * numerics::e / P_.tau_ex_;
-  V_.IPSCInitialValue_ = 1.0 * numerics::e / P_.tau_in_;
+  V.EPSCInitialValue_ = 1.0 * numerics::e / P_->tau_ex_;
+  V.IPSCInitialValue_ = 1.0 * numerics::e / P_->tau_in_;
 
   // TauR specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_alpha can only handle refractory
@@ -310,9 +388,12 @@ iaf_psc_alpha::calibrate()
   // results. However, a neuron model capable of operating with real valued
   // spike time may exhibit a different effective refractory time.
 
-  V_.RefractoryCounts_ = Time( Time::ms( P_.TauR_ ) ).get_steps();
+  V.RefractoryCounts_ = Time( Time::ms( P_->TauR_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
-  assert( V_.RefractoryCounts_ >= 0 );
+  assert( V.RefractoryCounts_ >= 0 );
+
+  // share the propagators with all neurons with equal parameters
+  V_ = V;
 }
 
 /* ----------------------------------------------------------------
@@ -331,11 +412,11 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
-      S_.y3_ = V_.P30_ * ( S_.y0_ + P_.I_e_ ) + V_.P31_ex_ * S_.dI_ex_ + V_.P32_ex_ * S_.I_ex_ + V_.P31_in_ * S_.dI_in_
-        + V_.P32_in_ * S_.I_in_ + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
+      S_.y3_ = V_->P30_ * ( S_.y0_ + P_->I_e_ ) + V_->P31_ex_ * S_.dI_ex_ + V_->P32_ex_ * S_.I_ex_
+        + V_->P31_in_ * S_.dI_in_ + V_->P32_in_ * S_.I_in_ + V_->expm1_tau_m_ * S_.y3_ + S_.y3_;
 
       // lower bound of membrane potential
-      S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_ );
+      S_.y3_ = ( S_.y3_ < P_->LowerBound_ ? P_->LowerBound_ : S_.y3_ );
     }
     else
     {
@@ -344,8 +425,8 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     }
 
     // alpha shape EPSCs
-    S_.I_ex_ = V_.P21_ex_ * S_.dI_ex_ + V_.P22_ex_ * S_.I_ex_;
-    S_.dI_ex_ *= V_.P11_ex_;
+    S_.I_ex_ = V_->P21_ex_ * S_.dI_ex_ + V_->P22_ex_ * S_.I_ex_;
+    S_.dI_ex_ *= V_->P11_ex_;
 
     // get read access to the correct input-buffer slot
     const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
@@ -353,23 +434,23 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
-    V_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
-    S_.dI_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
+    S_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
+    S_.dI_ex_ += V_->EPSCInitialValue_ * S_.weighted_spikes_ex_;
 
     // alpha shape EPSCs
-    S_.I_in_ = V_.P21_in_ * S_.dI_in_ + V_.P22_in_ * S_.I_in_;
-    S_.dI_in_ *= V_.P11_in_;
+    S_.I_in_ = V_->P21_in_ * S_.dI_in_ + V_->P22_in_ * S_.I_in_;
+    S_.dI_in_ *= V_->P11_in_;
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
-    V_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
-    S_.dI_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
+    S_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
+    S_.dI_in_ += V_->IPSCInitialValue_ * S_.weighted_spikes_in_;
 
     // threshold crossing
-    if ( S_.y3_ >= P_.Theta_ )
+    if ( S_.y3_ >= P_->Theta_ )
     {
-      S_.r_ = V_.RefractoryCounts_;
-      S_.y3_ = P_.V_reset_;
+      S_.r_ = V_->RefractoryCounts_;
+      S_.y3_ = P_->V_reset_;
       // A supra-threshold membrane potential should never be observable.
       // The reset at the time of threshold crossing enables accurate
       // integration independent of the computation step size, see [2,3] for
@@ -391,6 +472,217 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+bool
+iaf_psc_alpha::supports_population_update() const
+{
+  return true;
+}
+
+void
+iaf_psc_alpha::init_population( NodeBlock& block )
+{
+  block.resize_arrays( NUM_POP_ARRAYS );
+  block.logged.clear();
+  block.shared_parameters = true;
+
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    const iaf_psc_alpha& neuron = *static_cast< iaf_psc_alpha* >( block.nodes[ i ] );
+
+    block.get_array( POP_Y0 )[ i ] = neuron.S_.y0_;
+    block.get_array( POP_DI_EX )[ i ] = neuron.S_.dI_ex_;
+    block.get_array( POP_I_EX )[ i ] = neuron.S_.I_ex_;
+    block.get_array( POP_DI_IN )[ i ] = neuron.S_.dI_in_;
+    block.get_array( POP_I_IN )[ i ] = neuron.S_.I_in_;
+    block.get_array( POP_Y3 )[ i ] = neuron.S_.y3_;
+    block.get_array( POP_R )[ i ] = neuron.S_.r_;
+
+    block.get_array( POP_I_E )[ i ] = neuron.P_->I_e_;
+    block.get_array( POP_THETA )[ i ] = neuron.P_->Theta_;
+    // blends require finite values, the lower bound defaults to -inf
+    block.get_array( POP_LOWER_BOUND )[ i ] =
+      std::max( neuron.P_->LowerBound_, -std::numeric_limits< double >::max() );
+    block.get_array( POP_V_RESET )[ i ] = neuron.P_->V_reset_;
+
+    block.get_array( POP_EPSC_INITIAL_VALUE )[ i ] = neuron.V_->EPSCInitialValue_;
+    block.get_array( POP_IPSC_INITIAL_VALUE )[ i ] = neuron.V_->IPSCInitialValue_;
+    block.get_array( POP_REFRACTORY_COUNTS )[ i ] = neuron.V_->RefractoryCounts_;
+    block.get_array( POP_P11_EX )[ i ] = neuron.V_->P11_ex_;
+    block.get_array( POP_P21_EX )[ i ] = neuron.V_->P21_ex_;
+    block.get_array( POP_P22_EX )[ i ] = neuron.V_->P22_ex_;
+    block.get_array( POP_P31_EX )[ i ] = neuron.V_->P31_ex_;
+    block.get_array( POP_P32_EX )[ i ] = neuron.V_->P32_ex_;
+    block.get_array( POP_P11_IN )[ i ] = neuron.V_->P11_in_;
+    block.get_array( POP_P21_IN )[ i ] = neuron.V_->P21_in_;
+    block.get_array( POP_P22_IN )[ i ] = neuron.V_->P22_in_;
+    block.get_array( POP_P31_IN )[ i ] = neuron.V_->P31_in_;
+    block.get_array( POP_P32_IN )[ i ] = neuron.V_->P32_in_;
+    block.get_array( POP_P30 )[ i ] = neuron.V_->P30_;
+    block.get_array( POP_EXPM1_TAU_M )[ i ] = neuron.V_->expm1_tau_m_;
+    block.get_array( POP_SPIKES_EX )[ i ] = neuron.S_.weighted_spikes_ex_;
+    block.get_array( POP_SPIKES_IN )[ i ] = neuron.S_.weighted_spikes_in_;
+
+    // interned parameters and propagators are equal if they are the same
+    block.shared_parameters =
+      block.shared_parameters and neuron.P_.get() == P_.get() and neuron.V_.get() == V_.get();
+
+    if ( neuron.B_.logger_.has_loggers() )
+    {
+      block.logged.push_back( i );
+    }
+  }
+}
+
+void
+iaf_psc_alpha::update_population( NodeBlock& block, Time const& origin, const long from, const long to )
+{
+  if ( block.shared_parameters )
+  {
+    update_population_< SharedParameter >( block, origin, from, to );
+  }
+  else
+  {
+    update_population_< PerNodeParameter >( block, origin, from, to );
+  }
+}
+
+template < typename ParameterT >
+void
+iaf_psc_alpha::update_population_( NodeBlock& block, Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t n = block.nodes.size();
+
+  double* const y0 = block.get_array( POP_Y0 );
+  double* const dI_ex = block.get_array( POP_DI_EX );
+  double* const I_ex = block.get_array( POP_I_EX );
+  double* const dI_in = block.get_array( POP_DI_IN );
+  double* const I_in = block.get_array( POP_I_IN );
+  double* const y3 = block.get_array( POP_Y3 );
+  double* const r = block.get_array( POP_R );
+  const ParameterT I_e( block.get_array( POP_I_E ) );
+  const ParameterT Theta( block.get_array( POP_THETA ) );
+  const ParameterT LowerBound( block.get_array( POP_LOWER_BOUND ) );
+  const ParameterT V_reset( block.get_array( POP_V_RESET ) );
+  const ParameterT EPSCInitialValue( block.get_array( POP_EPSC_INITIAL_VALUE ) );
+  const ParameterT IPSCInitialValue( block.get_array( POP_IPSC_INITIAL_VALUE ) );
+  const ParameterT RefractoryCounts( block.get_array( POP_REFRACTORY_COUNTS ) );
+  const ParameterT P11_ex( block.get_array( POP_P11_EX ) );
+  const ParameterT P21_ex( block.get_array( POP_P21_EX ) );
+  const ParameterT P22_ex( block.get_array( POP_P22_EX ) );
+  const ParameterT P31_ex( block.get_array( POP_P31_EX ) );
+  const ParameterT P32_ex( block.get_array( POP_P32_EX ) );
+  const ParameterT P11_in( block.get_array( POP_P11_IN ) );
+  const ParameterT P21_in( block.get_array( POP_P21_IN ) );
+  const ParameterT P22_in( block.get_array( POP_P22_IN ) );
+  const ParameterT P31_in( block.get_array( POP_P31_IN ) );
+  const ParameterT P32_in( block.get_array( POP_P32_IN ) );
+  const ParameterT P30( block.get_array( POP_P30 ) );
+  const ParameterT expm1_tau_m( block.get_array( POP_EXPM1_TAU_M ) );
+  double* const spikes_ex = block.get_array( POP_SPIKES_EX );
+  double* const spikes_in = block.get_array( POP_SPIKES_IN );
+  double* const current = block.get_array( POP_CURRENT );
+  double* const spike = block.get_array( POP_SPIKE );
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of all neurons for this step and reset the
+    // processed input-buffer slots
+    const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      iaf_psc_alpha& neuron = *static_cast< iaf_psc_alpha* >( block.nodes[ i ] );
+      auto& input = neuron.B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+      spikes_ex[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in[ i ] = input[ Buffers_::SYN_IN ];
+      current[ i ] = input[ Buffers_::I0 ];
+      neuron.B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Advance all neurons by one step. This is the arithmetic of
+    // update(), with branches replaced by blends with masks of 0 or 1,
+    // such that all operands are computed unconditionally and the loop
+    // can be vectorized.
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double y3_old = y3[ i ];
+      const double r_old = r[ i ];
+      const double not_refractory = r_old == 0.;
+
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P31_ex[ i ] * dI_ex[ i ] + P32_ex[ i ] * I_ex[ i ]
+        + P31_in[ i ] * dI_in[ i ] + P32_in[ i ] * I_in[ i ] + expm1_tau_m[ i ] * y3_old + y3_old;
+      const double below_lower_bound = y3_new < LowerBound[ i ];
+      y3_new = below_lower_bound * LowerBound[ i ] + ( 1. - below_lower_bound ) * y3_new;
+
+      const double y3_i = not_refractory * y3_new + ( 1. - not_refractory ) * y3_old;
+      const double r_i = r_old - ( 1. - not_refractory );
+
+      I_ex[ i ] = P21_ex[ i ] * dI_ex[ i ] + P22_ex[ i ] * I_ex[ i ];
+      dI_ex[ i ] *= P11_ex[ i ];
+      dI_ex[ i ] += EPSCInitialValue[ i ] * spikes_ex[ i ];
+
+      I_in[ i ] = P21_in[ i ] * dI_in[ i ] + P22_in[ i ] * I_in[ i ];
+      dI_in[ i ] *= P11_in[ i ];
+      dI_in[ i ] += IPSCInitialValue[ i ] * spikes_in[ i ];
+
+      const double threshold_crossed = y3_i >= Theta[ i ];
+      r[ i ] = threshold_crossed * RefractoryCounts[ i ] + ( 1. - threshold_crossed ) * r_i;
+      y3[ i ] = threshold_crossed * V_reset[ i ] + ( 1. - threshold_crossed ) * y3_i;
+      spike[ i ] = threshold_crossed;
+
+      y0[ i ] = current[ i ];
+    }
+
+    // emit the spikes of this step in the order of the neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spike[ i ] != 0. )
+      {
+        iaf_psc_alpha& neuron = *static_cast< iaf_psc_alpha* >( block.nodes[ i ] );
+        neuron.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( neuron, se, lag );
+      }
+    }
+
+    // log state data of recorded neurons
+    for ( std::vector< index >::const_iterator it = block.logged.begin(); it != block.logged.end(); ++it )
+    {
+      iaf_psc_alpha& neuron = *static_cast< iaf_psc_alpha* >( block.nodes[ *it ] );
+      neuron.store_population_state_( block, *it );
+      neuron.B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+}
+
+void
+iaf_psc_alpha::finalize_population( NodeBlock& block )
+{
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    static_cast< iaf_psc_alpha* >( block.nodes[ i ] )->store_population_state_( block, i );
+  }
+}
+
+void
+iaf_psc_alpha::store_population_state_( NodeBlock& block, const index i )
+{
+  S_.y0_ = block.get_array( POP_Y0 )[ i ];
+  S_.dI_ex_ = block.get_array( POP_DI_EX )[ i ];
+  S_.I_ex_ = block.get_array( POP_I_EX )[ i ];
+  S_.dI_in_ = block.get_array( POP_DI_IN )[ i ];
+  S_.I_in_ = block.get_array( POP_I_IN )[ i ];
+  S_.y3_ = block.get_array( POP_Y3 )[ i ];
+  S_.r_ = block.get_array( POP_R )[ i ];
+  S_.weighted_spikes_ex_ = block.get_array( POP_SPIKES_EX )[ i ];
+  S_.weighted_spikes_in_ = block.get_array( POP_SPIKES_IN )[ i ];
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
@@ -23,6 +23,9 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// Includes from libnestutil:
+#include "interned.h"
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
@@ -186,6 +189,11 @@ private:
 
   void update( Time const&, const long, const long );
 
+  bool supports_population_update() const;
+  void init_population( NodeBlock& );
+  void update_population( NodeBlock&, Time const&, const long, const long );
+  void finalize_population( NodeBlock& );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -228,6 +236,9 @@ private:
 
     Parameters_(); //!< Sets default parameter values
 
+    bool operator==( const Parameters_& ) const;
+    size_t hash() const; //!< Hash of the values, for Interned
+
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
 
     /** Set values from dictionary.
@@ -250,6 +261,9 @@ private:
 
     int r_; //!< Number of refractory steps remaining
 
+    double weighted_spikes_ex_; //!< Excitatory spike input of the last step
+    double weighted_spikes_in_; //!< Inhibitory spike input of the last step
+
     State_(); //!< Default initialization
 
     void get( DictionaryDatum&, const Parameters_& ) const;
@@ -313,29 +327,81 @@ private:
     double P33_;
     double expm1_tau_m_;
 
-    double weighted_spikes_ex_;
-    double weighted_spikes_in_;
+    bool operator==( const Variables_& ) const;
+    size_t hash() const; //!< Hash of the values, for Interned
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Arrays of the structure of arrays in which the population update
+   * keeps state, parameters, propagators and input of all neurons of a
+   * block, see update_population().
+   */
+  enum PopulationArrays_
+  {
+    POP_Y0 = 0,
+    POP_DI_EX,
+    POP_I_EX,
+    POP_DI_IN,
+    POP_I_IN,
+    POP_Y3,
+    POP_R,
+    POP_I_E,
+    POP_THETA,
+    POP_LOWER_BOUND,
+    POP_V_RESET,
+    POP_EPSC_INITIAL_VALUE,
+    POP_IPSC_INITIAL_VALUE,
+    POP_REFRACTORY_COUNTS,
+    POP_P11_EX,
+    POP_P21_EX,
+    POP_P22_EX,
+    POP_P31_EX,
+    POP_P32_EX,
+    POP_P11_IN,
+    POP_P21_IN,
+    POP_P22_IN,
+    POP_P31_IN,
+    POP_P32_IN,
+    POP_P30,
+    POP_EXPM1_TAU_M,
+    POP_SPIKES_EX,
+    POP_SPIKES_IN,
+    POP_CURRENT,
+    POP_SPIKE,
+    NUM_POP_ARRAYS
+  };
+
+  /**
+   * Update of a population whose parameters and propagators are read
+   * through ParameterT, PerNodeParameter or SharedParameter.
+   */
+  template < typename ParameterT >
+  void update_population_( NodeBlock&, Time const&, const long, const long );
+
+  //! Copy the state of this neuron, the i-th of the block, from the arrays
+  void store_population_state_( NodeBlock&, const index i );
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
   inline double
   get_V_m_() const
   {
-    return S_.y3_ + P_.E_L_;
+    return S_.y3_ + P_->E_L_;
   }
 
   inline double
   get_weighted_spikes_ex_() const
   {
-    return V_.weighted_spikes_ex_;
+    return S_.weighted_spikes_ex_;
   }
 
   inline double
   get_weighted_spikes_in_() const
   {
-    return V_.weighted_spikes_in_;
+    return S_.weighted_spikes_in_;
   }
 
   inline double
@@ -357,11 +423,13 @@ private:
    * Instances of private data structures for the different types
    * of data pertaining to the model.
    * @note The order of definitions is important for speed.
+   * @note Parameters and internal variables are shared by all neurons
+   *       with equal values, see Interned.
    * @{
    */
-  Parameters_ P_;
+  Interned< Parameters_ > P_;
   State_ S_;
-  Variables_ V_;
+  Interned< Variables_ > V_;
   Buffers_ B_;
   /** @} */
 
@@ -410,8 +478,8 @@ iaf_psc_alpha::handles_test_event( DataLoggingRequest& dlr, rport receptor_type
 inline void
 iaf_psc_alpha::get_status( DictionaryDatum& d ) const
 {
-  P_.get( d );
-  S_.get( d, P_ );
+  P_->get( d );
+  S_.get( d, *P_ );
   ArchivingNode::get_status( d );
 
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
@@ -420,7 +488,7 @@ iaf_psc_alpha::get_status( DictionaryDatum& d ) const
 inline void
 iaf_psc_alpha::set_status( const DictionaryDatum& d )
 {
-  Parameters_ ptmp = P_;                       // temporary copy in case of errors
+  Parameters_ ptmp = *P_;                      // temporary copy in case of errors
   const double delta_EL = ptmp.set( d, this ); // throws if BadProperty
   State_ stmp = S_;                            // temporary copy in case of errors
   stmp.set( d, ptmp, delta_EL, this );         // throws if BadProperty
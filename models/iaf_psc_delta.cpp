@@ -25,6 +25,7 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -34,6 +35,7 @@
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "node_block.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -337,6 +339,145 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+bool
+nest::iaf_psc_delta::supports_population_update() const
+{
+  // spikes arriving during the refractory period are discounted by
+  // their own exponential, which the population update does not model
+  return not P_.with_refr_input_;
+}
+
+void
+nest::iaf_psc_delta::init_population( NodeBlock& block )
+{
+  block.resize_arrays( NUM_POP_ARRAYS );
+  block.logged.clear();
+
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    const iaf_psc_delta& neuron = *static_cast< iaf_psc_delta* >( block.nodes[ i ] );
+
+    block.get_array( POP_Y0 )[ i ] = neuron.S_.y0_;
+    block.get_array( POP_Y3 )[ i ] = neuron.S_.y3_;
+    block.get_array( POP_R )[ i ] = neuron.S_.r_;
+
+    block.get_array( POP_I_E )[ i ] = neuron.P_.I_e_;
+    block.get_array( POP_V_TH )[ i ] = neuron.P_.V_th_;
+    // blends require finite values
+    block.get_array( POP_V_MIN )[ i ] = std::max( neuron.P_.V_min_, -std::numeric_limits< double >::max() );
+    block.get_array( POP_V_RESET )[ i ] = neuron.P_.V_reset_;
+
+    block.get_array( POP_REFRACTORY_COUNTS )[ i ] = neuron.V_.RefractoryCounts_;
+    block.get_array( POP_P30 )[ i ] = neuron.V_.P30_;
+    block.get_array( POP_P33 )[ i ] = neuron.V_.P33_;
+
+    if ( neuron.B_.logger_.has_loggers() )
+    {
+      block.logged.push_back( i );
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::update_population( NodeBlock& block, Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t n = block.nodes.size();
+
+  double* const y0 = block.get_array( POP_Y0 );
+  double* const y3 = block.get_array( POP_Y3 );
+  double* const r = block.get_array( POP_R );
+  const double* const I_e = block.get_array( POP_I_E );
+  const double* const V_th = block.get_array( POP_V_TH );
+  const double* const V_min = block.get_array( POP_V_MIN );
+  const double* const V_reset = block.get_array( POP_V_RESET );
+  const double* const RefractoryCounts = block.get_array( POP_REFRACTORY_COUNTS );
+  const double* const P30 = block.get_array( POP_P30 );
+  const double* const P33 = block.get_array( POP_P33 );
+  double* const spikes = block.get_array( POP_SPIKES );
+  double* const current = block.get_array( POP_CURRENT );
+  double* const spike = block.get_array( POP_SPIKE );
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of all neurons for this step; reading clears
+    // the ring buffer entries, also of refractory neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      iaf_psc_delta& neuron = *static_cast< iaf_psc_delta* >( block.nodes[ i ] );
+      spikes[ i ] = neuron.B_.spikes_.get_value( lag );
+      current[ i ] = neuron.B_.currents_.get_value( lag );
+    }
+
+    // Advance all neurons by one step. This is the arithmetic of
+    // update(), with branches replaced by blends with masks of 0 or 1,
+    // such that all operands are computed unconditionally and the loop
+    // can be vectorized.
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double y3_old = y3[ i ];
+      const double r_old = r[ i ];
+      const double not_refractory = r_old == 0.;
+
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P33[ i ] * y3_old + spikes[ i ];
+      const double below_V_min = y3_new < V_min[ i ];
+      y3_new = below_V_min * V_min[ i ] + ( 1. - below_V_min ) * y3_new;
+
+      const double y3_i = not_refractory * y3_new + ( 1. - not_refractory ) * y3_old;
+      const double r_i = r_old - ( 1. - not_refractory );
+
+      const double threshold_crossed = y3_i >= V_th[ i ];
+      r[ i ] = threshold_crossed * RefractoryCounts[ i ] + ( 1. - threshold_crossed ) * r_i;
+      y3[ i ] = threshold_crossed * V_reset[ i ] + ( 1. - threshold_crossed ) * y3_i;
+      spike[ i ] = threshold_crossed;
+
+      y0[ i ] = current[ i ];
+    }
+
+    // emit the spikes of this step in the order of the neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spike[ i ] != 0. )
+      {
+        iaf_psc_delta& neuron = *static_cast< iaf_psc_delta* >( block.nodes[ i ] );
+        neuron.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( neuron, se, lag );
+      }
+    }
+
+    // log state data of recorded neurons
+    for ( std::vector< index >::const_iterator it = block.logged.begin(); it != block.logged.end(); ++it )
+    {
+      iaf_psc_delta& neuron = *static_cast< iaf_psc_delta* >( block.nodes[ *it ] );
+      neuron.store_population_state_( block, *it );
+      neuron.B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::finalize_population( NodeBlock& block )
+{
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    static_cast< iaf_psc_delta* >( block.nodes[ i ] )->store_population_state_( block, i );
+  }
+}
+
+void
+nest::iaf_psc_delta::store_population_state_( NodeBlock& block, const index i )
+{
+  S_.y0_ = block.get_array( POP_Y0 )[ i ];
+  S_.y3_ = block.get_array( POP_Y3 )[ i ];
+  S_.r_ = block.get_array( POP_R )[ i ];
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
@@ -178,6 +178,11 @@ private:
 
   void update( Time const&, const long, const long );
 
+  bool supports_population_update() const;
+  void init_population( NodeBlock& );
+  void update_population( NodeBlock&, Time const&, const long, const long );
+  void finalize_population( NodeBlock& );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
@@ -290,6 +295,34 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Arrays of the structure of arrays in which the population update
+   * keeps state, parameters, propagators and input of all neurons of a
+   * block, see update_population().
+   */
+  enum PopulationArrays_
+  {
+    POP_Y0 = 0,
+    POP_Y3,
+    POP_R,
+    POP_I_E,
+    POP_V_TH,
+    POP_V_MIN,
+    POP_V_RESET,
+    POP_REFRACTORY_COUNTS,
+    POP_P30,
+    POP_P33,
+    POP_SPIKES,
+    POP_CURRENT,
+    POP_SPIKE,
+    NUM_POP_ARRAYS
+  };
+
+  //! Copy the state of this neuron, the i-th of the block, from the arrays
+  void store_population_state_( NodeBlock&, const index i );
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
@@ -24,6 +24,7 @@
 
 // C++ includes:
 #include <limits>
+#include <tuple>
 
 // Includes from libnestutil:
 #include "dict_util.h"
@@ -34,6 +35,7 @@
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "node_block.h"
 #include "ring_buffer_impl.h"
 #include "universal_data_logger_impl.h"
 
@@ -92,9 +94,37 @@ nest::iaf_psc_exp::State_::State_()
   , i_syn_in_( 0.0 )
   , V_m_( 0.0 )
   , r_ref_( 0 )
+  , weighted_spikes_ex_( 0.0 )
+  , weighted_spikes_in_( 0.0 )
 {
 }
 
+bool
+nest::iaf_psc_exp::Parameters_::operator==( const Parameters_& p ) const
+{
+  return std::tie( Tau_, C_, t_ref_, E_L_, I_e_, Theta_, V_reset_, tau_ex_, tau_in_, rho_, delta_ )
+    == std::tie( p.Tau_, p.C_, p.t_ref_, p.E_L_, p.I_e_, p.Theta_, p.V_reset_, p.tau_ex_, p.tau_in_, p.rho_, p.delta_ );
+}
+
+size_t
+nest::iaf_psc_exp::Parameters_::hash() const
+{
+  return hash_values( Tau_, C_, t_ref_, E_L_, I_e_, Theta_, V_reset_, tau_ex_, tau_in_, rho_, delta_ );
+}
+
+bool
+nest::iaf_psc_exp::Variables_::operator==( const Variables_& v ) const
+{
+  return std::tie( P20_, P11ex_, P11in_, P21ex_, P21in_, P22_, RefractoryCounts_, rng_ )
+    == std::tie( v.P20_, v.P11ex_, v.P11in_, v.P21ex_, v.P21in_, v.P22_, v.RefractoryCounts_, v.rng_ );
+}
+
+size_t
+nest::iaf_psc_exp::Variables_::hash() const
+{
+  return hash_values( P20_, P11ex_, P11in_, P21ex_, P21in_, P22_, RefractoryCounts_, rng_ );
+}
+
 /* ----------------------------------------------------------------
  * Parameter and state extractions and manipulation functions
  * ---------------------------------------------------------------- */
@@ -215,7 +245,7 @@ nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
 
 nest::iaf_psc_exp::iaf_psc_exp()
   : ArchivingNode()
-  , P_()
+  , P_( Parameters_() )
   , S_()
   , B_( *this )
 {
@@ -257,29 +287,31 @@ nest::iaf_psc_exp::calibrate()
 
   const double h = Time::get_resolution().get_ms();
 
+  Variables_ V;
+
   // numbering of state vaiables: i_0 = 0, i_syn_ = 1, V_m_ = 2
 
   // commented out propagators: forward Euler
   // needed to exactly reproduce Tsodyks network
 
   // these P are independent
-  V_.P11ex_ = std::exp( -h / P_.tau_ex_ );
+  V.P11ex_ = std::exp( -h / P_->tau_ex_ );
   // P11ex_ = 1.0-h/tau_ex_;
 
-  V_.P11in_ = std::exp( -h / P_.tau_in_ );
+  V.P11in_ = std::exp( -h / P_->tau_in_ );
   // P11in_ = 1.0-h/tau_in_;
 
-  V_.P22_ = std::exp( -h / P_.Tau_ );
+  V.P22_ = std::exp( -h / P_->Tau_ );
   // P22_ = 1.0-h/Tau_;
 
   // these are determined according to a numeric stability criterion
-  V_.P21ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P21in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
+  V.P21ex_ = propagator_32( P_->tau_ex_, P_->Tau_, P_->C_, h );
+  V.P21in_ = propagator_32( P_->tau_in_, P_->Tau_, P_->C_, h );
 
   // P21ex_ = h/C_;
   // P21in_ = h/C_;
 
-  V_.P20_ = P_.Tau_ / P_.C_ * ( 1.0 - V_.P22_ );
+  V.P20_ = P_->Tau_ / P_->C_ * ( 1.0 - V.P22_ );
   // P20_ = h/C_;
 
   // t_ref_ specifies the length of the absolute refractory period as
@@ -299,11 +331,14 @@ nest::iaf_psc_exp::calibrate()
   // results. However, a neuron model capable of operating with real valued
   // spike time may exhibit a different effective refractory time.
 
-  V_.RefractoryCounts_ = Time( Time::ms( P_.t_ref_ ) ).get_steps();
+  V.RefractoryCounts_ = Time( Time::ms( P_->t_ref_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
-  assert( V_.RefractoryCounts_ >= 0 );
+  assert( V.RefractoryCounts_ >= 0 );
 
-  V_.rng_ = get_vp_specific_rng( get_thread() );
+  V.rng_ = get_vp_specific_rng( get_thread() );
+
+  // share the propagators with all neurons with equal parameters
+  V_ = V;
 }
 
 void
@@ -320,7 +355,7 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
     {
       S_.V_m_ =
-        S_.V_m_ * V_.P22_ + S_.i_syn_ex_ * V_.P21ex_ + S_.i_syn_in_ * V_.P21in_ + ( P_.I_e_ + S_.i_0_ ) * V_.P20_;
+        S_.V_m_ * V_->P22_ + S_.i_syn_ex_ * V_->P21ex_ + S_.i_syn_in_ * V_->P21in_ + ( P_->I_e_ + S_.i_0_ ) * V_->P20_;
     }
     else
     {
@@ -329,11 +364,11 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     }
 
     // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+    S_.i_syn_ex_ *= V_->P11ex_;
+    S_.i_syn_in_ *= V_->P11in_;
 
     // add evolution of presynaptic input current
-    S_.i_syn_ex_ += ( 1. - V_.P11ex_ ) * S_.i_1_;
+    S_.i_syn_ex_ += ( 1. - V_->P11ex_ ) * S_.i_1_;
 
     // get read access to the correct input-buffer slot
     const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
@@ -342,17 +377,17 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     // the spikes arriving at T+1 have an immediate effect on the state of the
     // neuron
 
-    V_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
-    V_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
+    S_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
+    S_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
 
-    S_.i_syn_ex_ += V_.weighted_spikes_ex_;
-    S_.i_syn_in_ += V_.weighted_spikes_in_;
+    S_.i_syn_ex_ += S_.weighted_spikes_ex_;
+    S_.i_syn_in_ += S_.weighted_spikes_in_;
 
-    if ( ( P_.delta_ < 1e-10 and S_.V_m_ >= P_.Theta_ )                   // deterministic threshold crossing
-      or ( P_.delta_ > 1e-10 and V_.rng_->drand() < phi_() * h * 1e-3 ) ) // stochastic threshold crossing
+    if ( ( P_->delta_ < 1e-10 and S_.V_m_ >= P_->Theta_ )                   // deterministic threshold crossing
+      or ( P_->delta_ > 1e-10 and V_->rng_->drand() < phi_() * h * 1e-3 ) ) // stochastic threshold crossing
     {
-      S_.r_ref_ = V_.RefractoryCounts_;
-      S_.V_m_ = P_.V_reset_;
+      S_.r_ref_ = V_->RefractoryCounts_;
+      S_.V_m_ = P_->V_reset_;
 
       set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
 
@@ -372,6 +407,195 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+bool
+nest::iaf_psc_exp::supports_population_update() const
+{
+  // the stochastic threshold draws random numbers in the order of the
+  // neurons and steps, which the population update does not preserve
+  return P_->delta_ < 1e-10;
+}
+
+void
+nest::iaf_psc_exp::init_population( NodeBlock& block )
+{
+  block.resize_arrays( NUM_POP_ARRAYS );
+  block.logged.clear();
+  block.shared_parameters = true;
+
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    const iaf_psc_exp& neuron = *static_cast< iaf_psc_exp* >( block.nodes[ i ] );
+
+    block.get_array( POP_I_0 )[ i ] = neuron.S_.i_0_;
+    block.get_array( POP_I_1 )[ i ] = neuron.S_.i_1_;
+    block.get_array( POP_I_SYN_EX )[ i ] = neuron.S_.i_syn_ex_;
+    block.get_array( POP_I_SYN_IN )[ i ] = neuron.S_.i_syn_in_;
+    block.get_array( POP_V_M )[ i ] = neuron.S_.V_m_;
+    block.get_array( POP_R_REF )[ i ] = neuron.S_.r_ref_;
+
+    block.get_array( POP_I_E )[ i ] = neuron.P_->I_e_;
+    block.get_array( POP_THETA )[ i ] = neuron.P_->Theta_;
+    block.get_array( POP_V_RESET )[ i ] = neuron.P_->V_reset_;
+
+    block.get_array( POP_REFRACTORY_COUNTS )[ i ] = neuron.V_->RefractoryCounts_;
+    block.get_array( POP_P20 )[ i ] = neuron.V_->P20_;
+    block.get_array( POP_P11EX )[ i ] = neuron.V_->P11ex_;
+    block.get_array( POP_P11IN )[ i ] = neuron.V_->P11in_;
+    block.get_array( POP_P21EX )[ i ] = neuron.V_->P21ex_;
+    block.get_array( POP_P21IN )[ i ] = neuron.V_->P21in_;
+    block.get_array( POP_P22 )[ i ] = neuron.V_->P22_;
+    block.get_array( POP_SPIKES_EX )[ i ] = neuron.S_.weighted_spikes_ex_;
+    block.get_array( POP_SPIKES_IN )[ i ] = neuron.S_.weighted_spikes_in_;
+
+    // interned parameters and propagators are equal if they are the same
+    block.shared_parameters =
+      block.shared_parameters and neuron.P_.get() == P_.get() and neuron.V_.get() == V_.get();
+
+    if ( neuron.B_.logger_.has_loggers() )
+    {
+      block.logged.push_back( i );
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::update_population( NodeBlock& block, const Time& origin, const long from, const long to )
+{
+  if ( block.shared_parameters )
+  {
+    update_population_< SharedParameter >( block, origin, from, to );
+  }
+  else
+  {
+    update_population_< PerNodeParameter >( block, origin, from, to );
+  }
+}
+
+template < typename ParameterT >
+void
+nest::iaf_psc_exp::update_population_( NodeBlock& block, const Time& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t n = block.nodes.size();
+
+  double* const i_0 = block.get_array( POP_I_0 );
+  double* const i_1 = block.get_array( POP_I_1 );
+  double* const i_syn_ex = block.get_array( POP_I_SYN_EX );
+  double* const i_syn_in = block.get_array( POP_I_SYN_IN );
+  double* const V_m = block.get_array( POP_V_M );
+  double* const r_ref = block.get_array( POP_R_REF );
+  const ParameterT I_e( block.get_array( POP_I_E ) );
+  const ParameterT Theta( block.get_array( POP_THETA ) );
+  const ParameterT V_reset( block.get_array( POP_V_RESET ) );
+  const ParameterT RefractoryCounts( block.get_array( POP_REFRACTORY_COUNTS ) );
+  const ParameterT P20( block.get_array( POP_P20 ) );
+  const ParameterT P11ex( block.get_array( POP_P11EX ) );
+  const ParameterT P11in( block.get_array( POP_P11IN ) );
+  const ParameterT P21ex( block.get_array( POP_P21EX ) );
+  const ParameterT P21in( block.get_array( POP_P21IN ) );
+  const ParameterT P22( block.get_array( POP_P22 ) );
+  double* const spikes_ex = block.get_array( POP_SPIKES_EX );
+  double* const spikes_in = block.get_array( POP_SPIKES_IN );
+  double* const current_0 = block.get_array( POP_CURRENT_0 );
+  double* const current_1 = block.get_array( POP_CURRENT_1 );
+  double* const spike = block.get_array( POP_SPIKE );
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of all neurons for this step and reset the
+    // processed input-buffer slots
+    const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      iaf_psc_exp& neuron = *static_cast< iaf_psc_exp* >( block.nodes[ i ] );
+      auto& input = neuron.B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+      spikes_ex[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in[ i ] = input[ Buffers_::SYN_IN ];
+      current_0[ i ] = input[ Buffers_::I0 ];
+      current_1[ i ] = input[ Buffers_::I1 ];
+      neuron.B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Advance all neurons by one step. This is the arithmetic of
+    // update(), with branches replaced by blends with masks of 0 or 1,
+    // such that all operands are computed unconditionally and the loop
+    // can be vectorized.
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double V_m_old = V_m[ i ];
+      const double r_ref_old = r_ref[ i ];
+      const double not_refractory = r_ref_old == 0.;
+
+      const double V_m_new = V_m_old * P22[ i ] + i_syn_ex[ i ] * P21ex[ i ] + i_syn_in[ i ] * P21in[ i ]
+        + ( I_e[ i ] + i_0[ i ] ) * P20[ i ];
+      const double V_m_i = not_refractory * V_m_new + ( 1. - not_refractory ) * V_m_old;
+      const double r_ref_i = r_ref_old - ( 1. - not_refractory );
+
+      i_syn_ex[ i ] *= P11ex[ i ];
+      i_syn_in[ i ] *= P11in[ i ];
+      i_syn_ex[ i ] += ( 1. - P11ex[ i ] ) * i_1[ i ];
+
+      i_syn_ex[ i ] += spikes_ex[ i ];
+      i_syn_in[ i ] += spikes_in[ i ];
+
+      const double threshold_crossed = V_m_i >= Theta[ i ];
+      r_ref[ i ] = threshold_crossed * RefractoryCounts[ i ] + ( 1. - threshold_crossed ) * r_ref_i;
+      V_m[ i ] = threshold_crossed * V_reset[ i ] + ( 1. - threshold_crossed ) * V_m_i;
+      spike[ i ] = threshold_crossed;
+
+      i_0[ i ] = current_0[ i ];
+      i_1[ i ] = current_1[ i ];
+    }
+
+    // emit the spikes of this step in the order of the neurons
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spike[ i ] != 0. )
+      {
+        iaf_psc_exp& neuron = *static_cast< iaf_psc_exp* >( block.nodes[ i ] );
+        neuron.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( neuron, se, lag );
+      }
+    }
+
+    // log state data of recorded neurons
+    for ( std::vector< index >::const_iterator it = block.logged.begin(); it != block.logged.end(); ++it )
+    {
+      iaf_psc_exp& neuron = *static_cast< iaf_psc_exp* >( block.nodes[ *it ] );
+      neuron.store_population_state_( block, *it );
+      neuron.B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::finalize_population( NodeBlock& block )
+{
+  for ( size_t i = 0; i < block.nodes.size(); ++i )
+  {
+    static_cast< iaf_psc_exp* >( block.nodes[ i ] )->store_population_state_( block, i );
+  }
+}
+
+void
+nest::iaf_psc_exp::store_population_state_( NodeBlock& block, const index i )
+{
+  S_.i_0_ = block.get_array( POP_I_0 )[ i ];
+  S_.i_1_ = block.get_array( POP_I_1 )[ i ];
+  S_.i_syn_ex_ = block.get_array( POP_I_SYN_EX )[ i ];
+  S_.i_syn_in_ = block.get_array( POP_I_SYN_IN )[ i ];
+  S_.V_m_ = block.get_array( POP_V_M )[ i ];
+  S_.r_ref_ = block.get_array( POP_R_REF )[ i ];
+  S_.weighted_spikes_ex_ = block.get_array( POP_SPIKES_EX )[ i ];
+  S_.weighted_spikes_in_ = block.get_array( POP_SPIKES_IN )[ i ];
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
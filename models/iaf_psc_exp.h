@@ -23,6 +23,9 @@
 #ifndef IAF_PSC_EXP_H
 #define IAF_PSC_EXP_H
 
+// Includes from libnestutil:
+#include "interned.h"
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
@@ -196,6 +199,11 @@ private:
 
   void update( const Time&, const long, const long );
 
+  bool supports_population_update() const;
+  void init_population( NodeBlock& );
+  void update_population( NodeBlock&, const Time&, const long, const long );
+  void finalize_population( NodeBlock& );
+
   // intensity function
   double phi_() const;
 
@@ -246,6 +254,9 @@ private:
 
     Parameters_(); //!< Sets default parameter values
 
+    bool operator==( const Parameters_& ) const;
+    size_t hash() const; //!< Hash of the values, for Interned
+
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
 
     /** Set values from dictionary.
@@ -272,6 +283,9 @@ private:
     //! absolute refractory counter (no membrane potential propagation)
     int r_ref_;
 
+    double weighted_spikes_ex_; //!< Excitatory spike input of the last step
+    double weighted_spikes_in_; //!< Inhibitory spike input of the last step
+
     State_(); //!< Default initialization
 
     void get( DictionaryDatum&, const Parameters_& ) const;
@@ -333,33 +347,76 @@ private:
     double P21in_;
     double P22_;
 
-    double weighted_spikes_ex_;
-    double weighted_spikes_in_;
-
     int RefractoryCounts_;
 
     RngPtr rng_; //!< random number generator of my own thread
+
+    bool operator==( const Variables_& ) const;
+    size_t hash() const; //!< Hash of the values, for Interned
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Arrays of the structure of arrays in which the population update
+   * keeps state, parameters, propagators and input of all neurons of a
+   * block, see update_population().
+   */
+  enum PopulationArrays_
+  {
+    POP_I_0 = 0,
+    POP_I_1,
+    POP_I_SYN_EX,
+    POP_I_SYN_IN,
+    POP_V_M,
+    POP_R_REF,
+    POP_I_E,
+    POP_THETA,
+    POP_V_RESET,
+    POP_REFRACTORY_COUNTS,
+    POP_P20,
+    POP_P11EX,
+    POP_P11IN,
+    POP_P21EX,
+    POP_P21IN,
+    POP_P22,
+    POP_SPIKES_EX,
+    POP_SPIKES_IN,
+    POP_CURRENT_0,
+    POP_CURRENT_1,
+    POP_SPIKE,
+    NUM_POP_ARRAYS
+  };
+
+  /**
+   * Update of a population whose parameters and propagators are read
+   * through ParameterT, PerNodeParameter or SharedParameter.
+   */
+  template < typename ParameterT >
+  void update_population_( NodeBlock&, const Time&, const long, const long );
+
+  //! Copy the state of this neuron, the i-th of the block, from the arrays
+  void store_population_state_( NodeBlock&, const index i );
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
   inline double
   get_V_m_() const
   {
-    return S_.V_m_ + P_.E_L_;
+    return S_.V_m_ + P_->E_L_;
   }
 
   inline double
   get_weighted_spikes_ex_() const
   {
-    return V_.weighted_spikes_ex_;
+    return S_.weighted_spikes_ex_;
   }
 
   inline double
   get_weighted_spikes_in_() const
   {
-    return V_.weighted_spikes_in_;
+    return S_.weighted_spikes_in_;
   }
 
   inline double
@@ -381,11 +438,13 @@ private:
    * Instances of private data structures for the different types
    * of data pertaining to the model.
    * @note The order of definitions is important for speed.
+   * @note Parameters and internal variables are shared by all neurons
+   *       with equal values, see Interned.
    * @{
    */
-  Parameters_ P_;
+  Interned< Parameters_ > P_;
   State_ S_;
-  Variables_ V_;
+  Interned< Variables_ > V_;
   Buffers_ B_;
   /** @} */
 
@@ -442,8 +501,8 @@ iaf_psc_exp::handles_test_event( DataLoggingRequest& dlr, rport receptor_type )
 inline void
 iaf_psc_exp::get_status( DictionaryDatum& d ) const
 {
-  P_.get( d );
-  S_.get( d, P_ );
+  P_->get( d );
+  S_.get( d, *P_ );
   ArchivingNode::get_status( d );
 
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
@@ -452,7 +511,7 @@ iaf_psc_exp::get_status( DictionaryDatum& d ) const
 inline void
 iaf_psc_exp::set_status( const DictionaryDatum& d )
 {
-  Parameters_ ptmp = P_;                       // temporary copy in case of errors
+  Parameters_ ptmp = *P_;                      // temporary copy in case of errors
   const double delta_EL = ptmp.set( d, this ); // throws if BadProperty
   State_ stmp = S_;                            // temporary copy in case of errors
   stmp.set( d, ptmp, delta_EL, this );         // throws if BadProperty
@@ -471,8 +530,8 @@ iaf_psc_exp::set_status( const DictionaryDatum& d )
 inline double
 iaf_psc_exp::phi_() const
 {
-  assert( P_.delta_ > 0. );
-  return P_.rho_ * std::exp( 1. / P_.delta_ * ( S_.V_m_ - P_.Theta_ ) );
+  assert( P_->delta_ > 0. );
+  return P_->rho_ * std::exp( 1. / P_->delta_ * ( S_.V_m_ - P_->Theta_ ) );
 }
 
 } // namespace
@@ -316,6 +316,11 @@ ModelsModule::init( SLIInterpreter* )
   register_connection_model< quantal_stp_synapse >( "quantal_stp_synapse" );
   register_connection_model< static_synapse >( "static_synapse" );
   register_connection_model< static_synapse_hom_w >( "static_synapse_hom_w" );
+  register_soa_connection_model< static_synapse >( "static_synapse_soa" );
+  register_soa_connection_model< static_synapse_hom_w >( "static_synapse_hom_w_soa" );
+  // spikes through static synapses to the most common neuron model are
+  // delivered without dynamic dispatch
+  register_spike_delivery_target< static_synapse, iaf_psc_alpha >( "static_synapse" );
   register_connection_model< stdp_synapse >( "stdp_synapse" );
   register_connection_model< stdp_synapse_hom >( "stdp_synapse_hom" );
   register_connection_model< stdp_dopamine_synapse >( "stdp_dopamine_synapse" );
@@ -25,6 +25,7 @@
 
 // Includes from nestkernel:
 #include "connection.h"
+#include "connector_soa.h"
 
 namespace nest
 {
@@ -42,6 +43,10 @@ Description
 static_synapse does not support any kind of plasticity. It simply stores
 the parameters target, weight, delay and receiver port for each connection.
 
+The variant static_synapse_soa behaves identically, but stores targets,
+weights and delays of all connections in separate arrays, which reduces
+the memory traffic of spike delivery. It does not support labels.
+
 Transmits
 +++++++++
 
@@ -66,6 +71,9 @@ public:
 
   typedef Connection< targetidentifierT > ConnectionBase;
 
+  //! weight column used when stored in a SoAConnector
+  typedef SoAIndividualWeights SoAWeightsType;
+
   /**
    * Default Constructor.
    * Sets default values for all parameters. Needed by GenericConnectorModel.
@@ -182,6 +190,12 @@ public:
 
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   void
   set_weight( double w )
   {
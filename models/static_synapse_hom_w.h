@@ -26,6 +26,7 @@
 // Includes from nestkernel:
 #include "common_properties_hom_w.h"
 #include "connection.h"
+#include "connector_soa.h"
 
 namespace nest
 {
@@ -50,6 +51,10 @@ The common weight for all connections of this model must be set by
 SetDefaults on the model. If you create copies of this model using
 CopyModel, each derived model can have a different weight.
 
+The variant static_synapse_hom_w_soa behaves identically, but stores
+targets and delays of all connections in separate arrays, which reduces
+the memory traffic of spike delivery. It does not support labels.
+
 Transmits
 +++++++++
 
@@ -72,6 +77,9 @@ public:
   typedef CommonPropertiesHomW CommonPropertiesType;
   typedef Connection< targetidentifierT > ConnectionBase;
 
+  //! weight column used when stored in a SoAConnector
+  typedef SoAHomogeneousWeights SoAWeightsType;
+
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places these
   // functions are used. Since ConnectionBase depends on the template parameter,
@@ -125,13 +125,12 @@ public:
   // connections not used in primary connectors
   typedef SecondaryEvent EventType;
 
+  typedef targetidentifierT TargetIdentifierType;
+
   Connection()
     : target_()
     , syn_id_delay_( 1.0 )
   {
-	 // targetidentifierT *p = &target_;
-#pragma omp target enter data map(to: target_)
-	  //std::cout << __PRETTY_FUNCTION__ << std::endl;
   }
 
   Connection( const Connection< targetidentifierT >& rhs ) = default;
@@ -87,10 +87,6 @@ nest::ConnectionManager::~ConnectionManager()
   // back to the system anyway. Hence, why bother cleaning up our highly
   // scattered connection infrastructure? They do not have any open files, which
   // need to be closed or similar.
-  for (int i=0;i<kernel().vp_manager.get_num_threads();i++) {
-	delete [] connections_array_[i];
-  }
-  delete connections_array_;
 }
 
 void
@@ -98,6 +94,7 @@ nest::ConnectionManager::initialize()
 {
   const thread num_threads = kernel().vp_manager.get_num_threads();
   connections_.resize( num_threads );
+  connectivity_snapshots_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
   sort_connections_by_source_ = true;
   compressed_spike_data_.resize( 0 );
@@ -106,9 +103,6 @@ nest::ConnectionManager::initialize()
   check_primary_connections_.initialize( num_threads, false );
   check_secondary_connections_.initialize( num_threads, false );
 
-  int num_synapse_prototypes = kernel().model_manager.get_num_synapse_prototypes();
-
-  connections_array_ = new ConnectorBase**[num_threads];
   set_has_get_connections_been_called( false );
 
 #pragma omp parallel
@@ -116,22 +110,8 @@ nest::ConnectionManager::initialize()
     const thread tid = kernel().vp_manager.get_thread_id();
     connections_[ tid ] = std::vector< ConnectorBase* >( kernel().model_manager.get_num_synapse_prototypes() );
     secondary_recv_buffer_pos_[ tid ] = std::vector< std::vector< size_t > >();
-  
-    connections_array_[tid] = new ConnectorBase*[num_synapse_prototypes];
   } // of omp parallel
 
-  for (int i=0;i<num_threads;i++) {
-	for (int j=0;j<num_synapse_prototypes;j++) {
-                if (connections_[i][j]) {
-		connections_array_[i][j] = connections_[i][j];
-		//std::cout << "XX " << typeid(connections_array_[i][j]).name() << std::endl;
-		//std::cout << "XX " << typeid(connections_[i][j]).name() << std::endl;
-		//std::cout << "XX " << typeid(static_cast<Connector<StaticConnection<TargetIdentifierPtrRport>>*>(connections_[i][j])->f4()).name() << std::endl;
-		}
-	}
-  }
-
-
   source_table_.initialize();
   target_table_.initialize();
   target_table_devices_.initialize();
@@ -145,54 +125,6 @@ nest::ConnectionManager::initialize()
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
   min_delay_ = max_delay_ = 1;
-
-  sources_array_ = new Source**[num_threads];
-
-  std::cout << __PRETTY_FUNCTION__ << " Map this ptr " << this << std::endl;
-#pragma omp target enter data map(to: this[0:1])
-  std::cout << __PRETTY_FUNCTION__ << " Map sources_array_ outer most " << std::endl;
-#pragma omp target enter data map(to: this->sources_array_[0:num_threads])
-  std::cout << __PRETTY_FUNCTION__ << " Map " << "connections_array_ " << this->connections_array_ << std::endl;
-#pragma omp target enter data map(to: connections_array_[0:num_threads])
-for(int i=0;i<num_threads;i++) {
-  std::cout << __PRETTY_FUNCTION__ << " Map connections_array_[i] " << this->connections_array_[i] << std::endl;	
-#pragma omp target enter data map(to: connections_array_[i][0:num_synapse_prototypes])
-}
-for (int i=0;i<num_threads;i++) {
-	for (int j=0;j<num_synapse_prototypes;j++) {
-//if (!this->connections_array_[i][j]	) {
-	//std::cout << i << " " << j << std::endl;
-	//static_cast<Connector<StaticConnection<TargetIdentifierPtrRport>>*>(this->connections_array_[i][j])->f4();
-	// Can only map non-null objects to the device
-	if (this->connections_array_[i][j]) {
-		//auto p_ = static_cast<Connector<StaticConnection<TargetIdentifierPtrRport>>*>(connections_array_[i][j]);
-		//std::cout << __PRETTY_FUNCTION__ << " Map " << p << " size of " << sizeof(*p) << std::endl; 
-//#pragma omp target enter data map(to: p_[0:1])
-	}
-//}
-//#pragma omp target enter data map(to: this->connections_array_[0][0][0:1])
-	}
-}
-}
-
-void
-nest::ConnectionManager::map_connections(thread tid) {
-	for (int i=0;i<kernel().model_manager.get_num_synapse_prototypes();i++) {
-			//size_t l = connections_[i][j]->size();
-			//connections_array_[i][j]= new ConnectorBase*[l];
-			//for (int k=0;k<l;k++) {
-			//if (j!=0) return;
-			//assert(connections_[i][j]);
-			connections_array_[tid][i]=connections_[tid][i];
-			//assert(connections_array_[i][j]);
-			//if (j==42 or j==72) {
-			if (connections_[tid][i] != nullptr) {
-				//std::cout << __PRETTY_FUNCTION__ << " connections_ " << connections_[i][j] << std::endl;
-				//std::cout << __PRETTY_FUNCTION__ << " connections_array_ " << connections_array_[i][j] << std::endl;
-				connections_array_[tid][i]->map_in();
-			}
-	}
-  sw_construction_connect.reset();
 }
 
 void
@@ -203,6 +135,7 @@ nest::ConnectionManager::finalize()
   target_table_devices_.finalize();
   delete_connections_();
   std::vector< std::vector< ConnectorBase* > >().swap( connections_ );
+  std::vector< ConnectivitySnapshot >().swap( connectivity_snapshots_ );
   std::vector< std::vector< std::vector< size_t > > >().swap( secondary_recv_buffer_pos_ );
   compressed_spike_data_.clear();
 }
@@ -333,6 +266,7 @@ nest::ConnectionManager::set_synapse_status( const index source_node_id,
            and connections_[ tid ][ syn_id ] != NULL ) ) )
     {
       connections_[ tid ][ syn_id ]->set_synapse_status( lcid, dict, cm );
+      connectivity_snapshots_[ tid ].clear();
     }
     else if ( source->has_proxies() and not target->has_proxies() and target->local_receiver() )
     {
@@ -416,6 +350,28 @@ nest::ConnectionManager::get_user_set_delay_extrema() const
   return user_set_delay_extrema;
 }
 
+nest::delay
+nest::ConnectionManager::get_min_connection_delay() const
+{
+  Time min_delay = Time::pos_inf();
+
+  std::vector< DelayChecker >::const_iterator it;
+  for ( it = delay_checkers_.begin(); it != delay_checkers_.end(); ++it )
+  {
+    min_delay = std::min( min_delay, it->get_min_connection_delay() );
+  }
+
+  if ( kernel().mpi_manager.get_num_processes() > 1 )
+  {
+    std::vector< delay > min_delays( kernel().mpi_manager.get_num_processes() );
+    min_delays[ kernel().mpi_manager.get_rank() ] = min_delay.get_steps();
+    kernel().mpi_manager.communicate( min_delays );
+    return *std::min_element( min_delays.begin(), min_delays.end() );
+  }
+
+  return min_delay.get_steps();
+}
+
 nest::ConnBuilder*
 nest::ConnectionManager::get_conn_builder( const std::string& name,
   NodeCollectionPTR sources,
@@ -1412,29 +1368,6 @@ nest::ConnectionManager::compute_target_data_buffer_size()
   }
 }
 
-void
-nest::ConnectionManager::copy_to(const thread tid) {
-
-  std::vector< BlockVector< Source > > v = source_table_.get_thread_local_sources(tid);
-  sources_array_[tid] = new Source*[v.size()];	
-	
-  for ( int j = 0; j < v.size(); ++j) {
-    if (v[j].size() == 0) continue;
-    BlockVector< Source > blv = v[j];
-    sources_array_[tid][j] = new Source[blv.size()];
-    for ( int k = 0; k < blv.size(); ++k ) {
-      sources_array_[tid][j][k] = blv[k];
-    }
-  }
-
-#pragma omp target enter data map(to: this->sources_array_[tid][0:v.size()])
-  for ( int j = 0; j < v.size(); ++j ) { // loop through synapse types
-    if (v[j].size() == 0) continue;
-#pragma omp target enter data map(to: this->sources_array_[tid][j][0:v[j].size()])
-  }
-
-}
-
 void
 nest::ConnectionManager::compute_compressed_secondary_recv_buffer_positions(
   const thread tid )
@@ -1720,8 +1653,66 @@ nest::ConnectionManager::unset_have_connections_changed( const thread tid )
   {
     have_connections_changed_[ tid ].set_false();
   }
+
+  // the connection infrastructure has been rebuilt, so any existing
+  // snapshot is outdated
+  connectivity_snapshots_[ tid ].clear();
 }
 
+const nest::ConnectivitySnapshot&
+nest::ConnectionManager::get_connectivity_snapshot( const thread tid )
+{
+  if ( have_connections_changed_[ tid ].is_true() )
+  {
+    throw KernelException( "Connectivity snapshots require an up-to-date connection infrastructure." );
+  }
+  if ( not keep_source_table_ )
+  {
+    throw KernelException( "Connectivity snapshots require keep_source_table to be set." );
+  }
+
+  ConnectivitySnapshot& snapshot = connectivity_snapshots_[ tid ];
+  if ( snapshot.is_valid() )
+  {
+    return snapshot;
+  }
+
+  size_t num_connections = 0;
+  for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+  {
+    if ( connections_[ tid ][ syn_id ] != NULL )
+    {
+      num_connections += connections_[ tid ][ syn_id ]->size();
+    }
+  }
+  snapshot.clear();
+  snapshot.reserve( num_connections );
+
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
+  const std::vector< BlockVector< Source > >& sources = source_table_.get_thread_local_sources( tid );
+  for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+  {
+    snapshot.begin_synapse_type( syn_id );
+    if ( connections_[ tid ][ syn_id ] != NULL )
+    {
+      connections_[ tid ][ syn_id ]->append_to_snapshot( tid, cm, sources[ syn_id ], snapshot );
+    }
+  }
+  snapshot.freeze();
+
+  return snapshot;
+}
+
+
+void
+nest::ConnectionManager::get_spike_target_ranks( std::vector< int >& is_target_rank ) const
+{
+  is_target_rank.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    target_table_.mark_target_ranks( tid, is_target_rank );
+  }
+}
 
 void
 nest::ConnectionManager::collect_compressed_spike_data( const thread tid )
@@ -33,6 +33,7 @@
 // Includes from nestkernel:
 #include "conn_builder.h"
 #include "connection_id.h"
+#include "connectivity_snapshot.h"
 #include "connector_base.h"
 #include "node_collection.h"
 #include "nest_time.h"
@@ -92,7 +93,6 @@ public:
 
   void compute_target_data_buffer_size();
   void compute_compressed_secondary_recv_buffer_positions( const thread tid );
-  void copy_to(const thread);
   std::vector< ConnectorBase* > &get_thread_local_connections(const thread tid ) {
 	return connections_[tid];
   };
@@ -236,6 +236,12 @@ public:
 
   const std::vector< Target >& get_remote_targets_of_local_node( const thread tid, const index lid ) const;
 
+  /**
+   * Returns one flag per rank that indicates whether the rank hosts
+   * targets of neurons on this rank.
+   */
+  void get_spike_target_ranks( std::vector< int >& is_target_rank ) const;
+
   index get_target_node_id( const thread tid, const synindex syn_id, const index lcid ) const;
 
   /**
@@ -260,6 +266,14 @@ public:
 
   bool get_user_set_delay_extrema() const;
 
+  /**
+   * Return the smallest delay of all connections in the network in
+   * steps, also if the user has set min_delay to a smaller value.
+   * Returns Time::pos_inf().get_steps() if there are no connections.
+   * Must be called by all ranks.
+   */
+  delay get_min_connection_delay() const;
+
   void
   send( const thread tid, const synindex syn_id, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e );
 
@@ -328,6 +342,8 @@ public:
     thread& target_rank,
     TargetData& next_target_data );
 
+  void count_target_data( const thread rank_start, const thread rank_end, std::vector< size_t >& counts ) const;
+
   void reject_last_target_data( const thread tid );
 
   void save_source_table_entry_point( const thread tid );
@@ -420,19 +436,33 @@ public:
   bool secondary_connections_exist() const;
 
   index get_source_node_id( const thread tid, const synindex syn_id, const index lcid );
-  
-  index get_source_node_id_device( const thread tid, const synindex syn_id, const index lcid );
+
+  /**
+   * Return the flattened connectivity of thread tid.
+   *
+   * The snapshot is built on first use after the connection
+   * infrastructure has been updated and is kept until connections are
+   * changed again. Requires an up-to-date connection infrastructure and
+   * keep_source_table to be set.
+   *
+   * @see ConnectivitySnapshot
+   */
+  const ConnectivitySnapshot& get_connectivity_snapshot( const thread tid );
 
   double get_stdp_eps() const;
 
   void set_stdp_eps( const double stdp_eps );
-  //ConnectorBase* **connections_array_;
 
   // public stop watch for benchmarking purposes
   // start and stop in high-level connect functions in nestmodule.cpp and nest.cpp
   Stopwatch sw_construction_connect;
 
-  const std::vector< SpikeData >& get_compressed_spike_data( const synindex syn_id, const index idx );
+  /**
+   * Return the lcids of the connections on thread tid that are
+   * addressed by a compressed spike with index idx for synapse type
+   * syn_id. The span is empty if the source has no targets on tid.
+   */
+  const LcidSpan& get_compressed_spike_data( const thread tid, const synindex syn_id, const index idx ) const;
 
 private:
   size_t get_num_target_data( const thread tid ) const;
@@ -470,7 +500,7 @@ private:
    * of all local connections
    */
   const Time get_max_delay_time_() const;
-  void map_connections(thread);
+
   /**
    * Deletes all connections.
    */
@@ -568,10 +598,13 @@ private:
    * structure: threads|synapses|connections
    */
   std::vector< std::vector< ConnectorBase* > > connections_;
-  
-  //**
-  ConnectorBase* **connections_array_;
-  void* p_;
+
+  /**
+   * Flattened copies of connections_, one per thread, built on demand
+   * by get_connectivity_snapshot().
+   */
+  std::vector< ConnectivitySnapshot > connectivity_snapshots_;
+
   /**
    * A structure to hold the node IDs of presynaptic neurons during
    * postsynaptic connection creation, before the connection
@@ -579,14 +612,15 @@ private:
    * Internally arranged in a 3d structure: threads|synapses|node IDs
    */
   SourceTable source_table_;
-  Source ***sources_array_; // Note that sources_ defined in source_table.h is a 3-D std::vector
 
   /**
    * A structure to hold "unpacked" spikes on the postsynaptic side if
    * spike compression is enabled. Internally arranged in a 3d
-   * structure: synapses|sources|spike data
+   * structure: threads|synapses|sources. Every source with targets on
+   * this process has the same index on all threads, and the entry of
+   * each thread holds the range of lcids of its targets on that thread.
    */
-  std::vector< std::vector< std::vector< SpikeData > > > compressed_spike_data_;
+  std::vector< std::vector< std::vector< LcidSpan > > > compressed_spike_data_;
 
   /**
    * Stores absolute position in receive buffer of secondary events.
@@ -795,6 +829,14 @@ ConnectionManager::get_next_target_data( const thread tid,
   return source_table_.get_next_target_data( tid, rank_start, rank_end, target_rank, next_target_data );
 }
 
+inline void
+ConnectionManager::count_target_data( const thread rank_start,
+  const thread rank_end,
+  std::vector< size_t >& counts ) const
+{
+  source_table_.count_target_data( rank_start, rank_end, counts );
+}
+
 inline const std::vector< size_t >&
 ConnectionManager::get_secondary_send_buffer_positions( const thread tid, const index lid, const synindex syn_id ) const
 {
@@ -819,12 +861,6 @@ ConnectionManager::get_source_node_id( const thread tid, const synindex syn_inde
   return source_table_.get_node_id( tid, syn_index, lcid );
 }
 
-inline index
-ConnectionManager::get_source_node_id_device( const thread tid, const synindex syn_index, const index lcid )
-{
-  return sources_array_[tid][syn_index][lcid].get_node_id();
-}
-
 inline bool
 ConnectionManager::has_primary_connections() const
 {
@@ -878,14 +914,14 @@ ConnectionManager::get_ptrConnectorBase( const thread tid,
   ConnectorModel** cm,
   Event& e )
 {
-  return connections_array_[ tid ][ syn_id ];
+  return connections_[ tid ][ syn_id ];
 }
 
 inline ConnectorBase*
 ConnectionManager::get_ptrConnectorBase( const thread tid,
   const synindex syn_id )
 {
-  return connections_array_[ tid ][ syn_id ];
+  return connections_[ tid ][ syn_id ];
 }
 
 inline void
@@ -911,10 +947,10 @@ nest::ConnectionManager::set_has_get_connections_been_called( const bool has_get
   has_get_connections_been_called_ = has_get_connections_been_called;
 }
 
-inline const std::vector< SpikeData >&
-ConnectionManager::get_compressed_spike_data( const synindex syn_id, const index idx )
+inline const LcidSpan&
+ConnectionManager::get_compressed_spike_data( const thread tid, const synindex syn_id, const index idx ) const
 {
-  return compressed_spike_data_.at( syn_id ).at( idx );
+  return compressed_spike_data_[ tid ][ syn_id ][ idx ];
 }
 
 inline void
@@ -0,0 +1,297 @@
+/*
+ *  connectivity_snapshot.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONNECTIVITY_SNAPSHOT_H
+#define CONNECTIVITY_SNAPSHOT_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from libnestutil:
+#include "config.h"
+
+// Includes from nestkernel:
+#include "nest_names.h"
+#include "nest_types.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "dictutils.h"
+
+namespace nest
+{
+
+/**
+ * Flattened copy of all connections stored on one thread.
+ *
+ * The connections are kept in contiguous columns (source node ID,
+ * thread-local index of the target, receptor port, weight, delay in
+ * steps and synapse type). Entries are ordered by synapse type and, for
+ * each synapse type, by local connection id (lcid). The offsets of the
+ * synapse types form the row pointer of a CSR layout, i.e., connection
+ * lcid of synapse type syn_id is found at position
+ * get_offset( syn_id ) + lcid.
+ *
+ * Snapshots are built on demand by
+ * ConnectionManager::get_connectivity_snapshot() from the sorted
+ * connection infrastructure and are discarded whenever the connection
+ * infrastructure is updated or the status of a connection is changed.
+ * Weights of plastic synapses are those at the time the snapshot was
+ * built.
+ *
+ * If NEST is built with offloading, the columns are mapped to the
+ * default device when the snapshot is frozen and unmapped when it is
+ * cleared, so target regions can access them without copying.
+ */
+class ConnectivitySnapshot
+{
+private:
+  std::vector< index > source_node_ids_;
+  std::vector< index > targets_;
+  std::vector< rport > rports_;
+  std::vector< double > weights_;
+  std::vector< delay > delays_;
+  std::vector< synindex > syn_ids_;
+
+  //! Position of the first entry of each synapse type, plus the total size
+  std::vector< size_t > syn_id_offsets_;
+
+  //! Whether the snapshot reflects the current connection infrastructure
+  bool valid_;
+
+public:
+  ConnectivitySnapshot()
+    : valid_( false )
+  {
+  }
+
+  /**
+   * Remove all entries and release the memory they occupy.
+   */
+  void
+  clear()
+  {
+#ifdef HAVE_OFFLOAD
+    if ( valid_ )
+    {
+      unmap_from_device_();
+    }
+#endif
+    std::vector< index >().swap( source_node_ids_ );
+    std::vector< index >().swap( targets_ );
+    std::vector< rport >().swap( rports_ );
+    std::vector< double >().swap( weights_ );
+    std::vector< delay >().swap( delays_ );
+    std::vector< synindex >().swap( syn_ids_ );
+    std::vector< size_t >().swap( syn_id_offsets_ );
+    valid_ = false;
+  }
+
+  void
+  reserve( const size_t num_connections )
+  {
+    source_node_ids_.reserve( num_connections );
+    targets_.reserve( num_connections );
+    rports_.reserve( num_connections );
+    weights_.reserve( num_connections );
+    delays_.reserve( num_connections );
+    syn_ids_.reserve( num_connections );
+  }
+
+  /**
+   * Start the entries of the next synapse type. Must be called for
+   * every synapse type in ascending order, also for those without
+   * connections.
+   */
+  void
+  begin_synapse_type( const synindex syn_id )
+  {
+    assert( syn_id == syn_id_offsets_.size() );
+    syn_id_offsets_.push_back( size() );
+  }
+
+  void
+  push_back( const index source_node_id,
+    const index target,
+    const rport receptor,
+    const double weight,
+    const delay delay_steps,
+    const synindex syn_id )
+  {
+    assert( syn_id + 1 == syn_id_offsets_.size() );
+    source_node_ids_.push_back( source_node_id );
+    targets_.push_back( target );
+    rports_.push_back( receptor );
+    weights_.push_back( weight );
+    delays_.push_back( delay_steps );
+    syn_ids_.push_back( syn_id );
+  }
+
+  /**
+   * Close the last synapse type and mark the snapshot as valid.
+   */
+  void
+  freeze()
+  {
+    syn_id_offsets_.push_back( size() );
+    valid_ = true;
+#ifdef HAVE_OFFLOAD
+    map_to_device_();
+#endif
+  }
+
+  bool
+  is_valid() const
+  {
+    return valid_;
+  }
+
+  size_t
+  size() const
+  {
+    return source_node_ids_.size();
+  }
+
+  size_t
+  get_num_synapse_types() const
+  {
+    return syn_id_offsets_.empty() ? 0 : syn_id_offsets_.size() - 1;
+  }
+
+  size_t
+  get_offset( const synindex syn_id ) const
+  {
+    return syn_id_offsets_[ syn_id ];
+  }
+
+  size_t
+  get_num_connections( const synindex syn_id ) const
+  {
+    return syn_id_offsets_[ syn_id + 1 ] - syn_id_offsets_[ syn_id ];
+  }
+
+  const index*
+  get_source_node_ids() const
+  {
+    return source_node_ids_.data();
+  }
+
+  const index*
+  get_targets() const
+  {
+    return targets_.data();
+  }
+
+  const rport*
+  get_rports() const
+  {
+    return rports_.data();
+  }
+
+  const double*
+  get_weights() const
+  {
+    return weights_.data();
+  }
+
+  const delay*
+  get_delays() const
+  {
+    return delays_.data();
+  }
+
+  const synindex*
+  get_syn_ids() const
+  {
+    return syn_ids_.data();
+  }
+
+private:
+#ifdef HAVE_OFFLOAD
+  void
+  map_to_device_()
+  {
+    const size_t n = size();
+    const index* sources = source_node_ids_.data();
+    const index* targets = targets_.data();
+    const rport* rports = rports_.data();
+    const double* weights = weights_.data();
+    const delay* delays = delays_.data();
+#pragma omp target enter data map( to : sources[ 0 : n ], targets[ 0 : n ], rports[ 0 : n ], weights[ 0 : n ], delays[ 0 : n ] )
+  }
+
+  void
+  unmap_from_device_()
+  {
+    const size_t n = size();
+    const index* sources = source_node_ids_.data();
+    const index* targets = targets_.data();
+    const rport* rports = rports_.data();
+    const double* weights = weights_.data();
+    const delay* delays = delays_.data();
+#pragma omp target exit data map( delete : sources[ 0 : n ], targets[ 0 : n ], rports[ 0 : n ], weights[ 0 : n ], delays[ 0 : n ] )
+  }
+#endif
+};
+
+/**
+ * Return the weight of a connection for the connectivity snapshot.
+ * Uses ConnectionT::get_weight() if available, the weight of the common
+ * properties for synapse types with homogeneous weight, and the status
+ * dictionary of the connection otherwise.
+ */
+template < typename ConnectionT, typename CommonPropertiesT >
+auto
+get_snapshot_weight_( const ConnectionT& c, const CommonPropertiesT&, int ) -> decltype( c.get_weight() )
+{
+  return c.get_weight();
+}
+
+template < typename ConnectionT, typename CommonPropertiesT >
+auto
+get_snapshot_weight_( const ConnectionT&, const CommonPropertiesT& cp, long ) -> decltype( cp.get_weight() )
+{
+  return cp.get_weight();
+}
+
+template < typename ConnectionT, typename CommonPropertiesT >
+double
+get_snapshot_weight_( const ConnectionT& c, const CommonPropertiesT&, ... )
+{
+  DictionaryDatum d( new Dictionary );
+  c.get_status( d );
+  double weight = 0.0;
+  updateValue< double >( d, names::weight, weight );
+  return weight;
+}
+
+template < typename ConnectionT, typename CommonPropertiesT >
+double
+get_snapshot_weight( const ConnectionT& c, const CommonPropertiesT& cp )
+{
+  return get_snapshot_weight_( c, cp, 0 );
+}
+
+} // namespace nest
+
+#endif /* #ifndef CONNECTIVITY_SNAPSHOT_H */
@@ -28,6 +28,7 @@
 
 // C++ includes:
 #include <cstdlib>
+#include <typeinfo>
 #include <vector>
 
 // Includes from libnestutil:
@@ -38,6 +39,7 @@
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection_label.h"
+#include "connectivity_snapshot.h"
 #include "connector_model.h"
 #include "event.h"
 #include "event2.h"
@@ -220,11 +222,26 @@ public:
    */
   virtual void disable_connection( const index lcid ) = 0;
 
+  /**
+   * Append all connections to the connectivity snapshot of thread tid.
+   * The sources are the entries of the source table for this synapse
+   * type, which are aligned with the connections.
+   */
+  virtual void append_to_snapshot( const thread tid,
+    const std::vector< ConnectorModel* >& cm,
+    const BlockVector< Source >& sources,
+    ConnectivitySnapshot& snapshot ) const = 0;
+
+  /**
+   * Return true if spikes can be delivered from the connectivity
+   * snapshot instead of through send(), i.e., if delivery neither
+   * changes nor records the state of the connections.
+   */
+  virtual bool supports_snapshot_delivery( const std::vector< ConnectorModel* >& cm ) const = 0;
+
   /**
    * Remove disabled connections from the connector.
    */
-  virtual void map_in() = 0;
-  virtual void map_out() = 0;
   virtual void remove_disabled_connections( const index first_disabled_index ) = 0;
 };
 
@@ -237,47 +254,9 @@ class Connector : public ConnectorBase
 private:
   BlockVector< ConnectionT > C_;
   const synindex syn_id_;
-  ConnectionT *C_1;
 
 
 public:
-  virtual void map_in() {
-	size_t array_size = C_.size();
-	std::cout << __PRETTY_FUNCTION__ << " array_size is " << array_size << std::endl;
-	C_1 = new ConnectionT[array_size];
-	int i=0;
-	size_t veclen = array_size;
-        for (typename BlockVector< ConnectionT >::const_iterator iter = C_.begin();
-                iter != C_.end();iter++) {
-                        C_1[i] = *iter;
-                                i++;
-        }
-        assert(i==veclen);
-	std::cout << __PRETTY_FUNCTION__ << " syn_id_ " << syn_id_ << " Mapping this pointer " << this << " size is " << sizeof(*this) << std::endl; 
-#pragma omp target enter data map(to: this[0:1])
-	std::cout << __PRETTY_FUNCTION__ << " Mapping C_1 pointer " << C_1 << std::endl; 
-	std::cout << __PRETTY_FUNCTION__ << " typeid() " << typeid(C_1[0]).name() << std::endl; 
-	//std::cout << __PRETTY_FUNCTION__ << " sizeof(C_1[0]) * array_size " << sizeof(C_1[0]) * array_size << std::endl; 
-#pragma omp target enter data map(to: C_1[0:array_size])
- /* 
-  iaf_psc_alpha* p[array_size];
-  targetindex p1[array_size];
-  for (int i=0;i<array_size;i++) {
-    if (std::is_same<nest::Node*, decltype(C_1[i].target_.target_)>::value) {
-      p[i] = static_cast<iaf_psc_alpha*>(C_1[i].target_.target_); 
-    }
-    if (std::is_same<nest::targetindex, decltype(C_1[i].target_.target_)>::value) {
-      p1[i] = C_1[i].target_.target_;
-    }
-#pragma omp target enter data map(to: p[0:array_size])
-  }*/
-  }
-
-  virtual void map_out() {
-	//size_t array_size = C_.size();
-	//#pragma omp target exit data map(from: this[0:1])
-	//#pragma omp target exit data map(from: this->C_1[0:81000000])
-  }
   explicit Connector( const synindex syn_id )
     : syn_id_( syn_id )
   {
@@ -287,7 +266,6 @@ public:
   ~Connector()
   {
     C_.clear();
-    delete[] C_1;
   }
 
   synindex
@@ -465,46 +443,6 @@ public:
     }
   }
 
-  //inline index f(const thread tid, const index lcid, ConnectorModel **cm, Event& e, typename ConnectionT::CommonPropertiesType const& cp, int *wr_e)//WeightRecorderEvent* wr_e) 
-  index f(const thread tid, const index lcid, ConnectorModel **cm, SpikeEvent& e )//WeightRecorderEvent* wr_e) 
-  {
-#if defined(__CUDA__) && !defined(__CUDA_ARCH__)
-     typename ConnectionT::CommonPropertiesType const& cp = 
-       static_cast< GenericConnectorModel< ConnectionT >* >( cm[syn_id_] )->get_common_properties();
-#endif
-  	  //printf("%s\n", __PRETTY_FUNCTION__);
-	  //printf("this pointer address in target %p\n", this);
-	  //printf("syn_id_ is %d\n", this->syn_id_);
-	  //printf("syn_id_ is %d\n", this->get_syn_id());
-		index lcid_offset =0;
-
-    while ( true )
-    {
-      ConnectionT& conn = C_1[ lcid + lcid_offset ];
-      const bool is_disabled = conn.is_disabled();
-      const bool source_has_more_targets = conn.source_has_more_targets();
-      //printf(" is %d\n", is_disabled);
-      e.set_port( lcid + lcid_offset );
-      if ( not is_disabled )
-      {
-        //conn.send( e, tid, cp );
-        conn.send( e, tid ); // CommonProperties is not used in this function
-	//WeightRecorderEvent wr_e;
-	//index *p;
-	//int *wr_e;
-        //send_weight_event_non_virtual( tid, lcid + lcid_offset, e, cp, p, wr_e );
-      }
-      if ( not source_has_more_targets )
-      {
-        break;
-      }
-      ++lcid_offset;
-    }
-  
-    return 1 + lcid_offset;
-  
-  }
-
   index
   send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e )
   {
@@ -538,33 +476,42 @@ public:
   index
   send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, SpikeEvent& e )
   {
-    typename ConnectionT::CommonPropertiesType const& cp =
-      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
-
-    index lcid_offset = 0;
-
-    while ( true )
-    {
-      ConnectionT& conn = C_[ lcid + lcid_offset ];
-      const bool is_disabled = conn.is_disabled();
-      const bool source_has_more_targets = conn.source_has_more_targets();
+    return send_spike_( tid, lcid, cm, e );
+  }
 
-      e.set_port( lcid + lcid_offset );
-      if ( not is_disabled )
-      {
-        conn.send( e, tid, cp );
-        send_weight_event( tid, lcid + lcid_offset, e, cp );
-      }
-      if ( not source_has_more_targets )
-      {
-        break;
-      }
-      ++lcid_offset;
-    }
+  /**
+   * Send SpikeEvent e to all targets of the source at position lcid of
+   * connector c, which must be a Connector< ConnectionT >. This is the
+   * statically dispatched counterpart of send() that is registered as
+   * SpikeDeliveryFunction of the synapse type.
+   */
+  static index
+  deliver_spike( ConnectorBase* c,
+    const thread tid,
+    const index lcid,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e )
+  {
+    return static_cast< Connector< ConnectionT >* >( c )->send_spike_( tid, lcid, cm, e );
+  }
 
-    return 1 + lcid_offset; // event was delivered to at least one target
+  /**
+   * Variant of deliver_spike() that sends spikes to targets of type
+   * TargetT as TypedSpikeEvent< TargetT >, such that conn.send() hands
+   * them to TargetT::handle() without dynamic dispatch. Spikes to
+   * targets of other types are sent as e.
+   */
+  template < typename TargetT >
+  static index
+  deliver_spike_to( ConnectorBase* c,
+    const thread tid,
+    const index lcid,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e )
+  {
+    return static_cast< Connector< ConnectionT >* >( c )->template send_spike_to_< TargetT >( tid, lcid, cm, e );
   }
- 
+
   // Implemented in connector_base_impl.h
   void send_weight_event( const thread tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp );
 
@@ -650,12 +597,120 @@ public:
     C_[ lcid ].disable();
   }
 
+  void
+  append_to_snapshot( const thread tid,
+    const std::vector< ConnectorModel* >& cm,
+    const BlockVector< Source >& sources,
+    ConnectivitySnapshot& snapshot ) const
+  {
+    assert( sources.size() == C_.size() );
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    typename BlockVector< Source >::const_iterator source_it = sources.begin();
+    for ( typename BlockVector< ConnectionT >::const_iterator it = C_.begin(); it != C_.end(); ++it, ++source_it )
+    {
+      snapshot.push_back( source_it->get_node_id(),
+        it->get_target( tid )->get_thread_lid(),
+        it->get_rport(),
+        get_snapshot_weight( *it, cp ),
+        it->get_delay_steps(),
+        syn_id_ );
+    }
+  }
+
+  bool
+  supports_snapshot_delivery( const std::vector< ConnectorModel* >& ) const
+  {
+    return false;
+  }
+
   void
   remove_disabled_connections( const index first_disabled_index )
   {
     assert( C_[ first_disabled_index ].is_disabled() );
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
   }
+
+private:
+  index
+  send_spike_( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, SpikeEvent& e )
+  {
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    index lcid_offset = 0;
+
+    while ( true )
+    {
+      ConnectionT& conn = C_[ lcid + lcid_offset ];
+      const bool is_disabled = conn.is_disabled();
+      const bool source_has_more_targets = conn.source_has_more_targets();
+
+      e.set_port( lcid + lcid_offset );
+      if ( not is_disabled )
+      {
+        conn.send( e, tid, cp );
+        // qualified call avoids dynamic dispatch of the virtual function
+        Connector< ConnectionT >::send_weight_event( tid, lcid + lcid_offset, e, cp );
+      }
+      if ( not source_has_more_targets )
+      {
+        break;
+      }
+      ++lcid_offset;
+    }
+
+    return 1 + lcid_offset; // event was delivered to at least one target
+  }
+
+  template < typename TargetT >
+  index
+  send_spike_to_( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, SpikeEvent& e )
+  {
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    // the dynamic type of typed_e is known here, so that the compiler
+    // can resolve the call of the event in conn.send() statically
+    TypedSpikeEvent< TargetT > typed_e;
+    typed_e.set_stamp( e.get_stamp() );
+    typed_e.set_offset( e.get_offset() );
+    typed_e.set_sender_node_id( e.get_sender_node_id() );
+    typed_e.set_multiplicity( e.get_multiplicity() );
+
+    index lcid_offset = 0;
+
+    while ( true )
+    {
+      ConnectionT& conn = C_[ lcid + lcid_offset ];
+      const bool is_disabled = conn.is_disabled();
+      const bool source_has_more_targets = conn.source_has_more_targets();
+
+      if ( not is_disabled )
+      {
+        if ( typeid( *conn.get_target( tid ) ) == typeid( TargetT ) )
+        {
+          typed_e.set_port( lcid + lcid_offset );
+          conn.send( typed_e, tid, cp );
+          Connector< ConnectionT >::send_weight_event( tid, lcid + lcid_offset, typed_e, cp );
+        }
+        else
+        {
+          e.set_port( lcid + lcid_offset );
+          conn.send( e, tid, cp );
+          Connector< ConnectionT >::send_weight_event( tid, lcid + lcid_offset, e, cp );
+        }
+      }
+      if ( not source_has_more_targets )
+      {
+        break;
+      }
+      ++lcid_offset;
+    }
+
+    return 1 + lcid_offset; // event was delivered to at least one target
+  }
 };
 
 } // of namespace nest
@@ -26,6 +26,7 @@
 // C++ includes:
 #include <cmath>
 #include <string>
+#include <vector>
 
 // Includes from libnestutil:
 #include "numerics.h"
@@ -41,10 +42,32 @@
 namespace nest
 {
 class ConnectorBase;
+class ConnectorModel;
+template < typename ConnectionT >
+class Connector;
 class CommonSynapseProperties;
 class TimeConverter;
 class Node;
 
+/**
+ * Signature of the statically dispatched spike delivery function of a
+ * synapse type.
+ *
+ * The function sends the SpikeEvent to all targets of the source at
+ * position lcid in the given Connector and returns the number of
+ * connections visited. It casts the ConnectorBase to the concrete
+ * Connector< ConnectionT > of the synapse type, such that spike delivery
+ * does not require a virtual call per spike.
+ *
+ * @see Connector::deliver_spike
+ * @see EventDeliveryManager::deliver_events_
+ */
+typedef index ( *SpikeDeliveryFunction )( ConnectorBase*,
+  const thread,
+  const index,
+  const std::vector< ConnectorModel* >&,
+  SpikeEvent& );
+
 class ConnectorModel
 {
 
@@ -105,6 +128,12 @@ public:
 
   virtual std::vector< SecondaryEvent* > create_event( size_t n ) const = 0;
 
+  /**
+   * Return the function that delivers spikes through Connectors of this
+   * synapse type.
+   */
+  virtual SpikeDeliveryFunction get_spike_delivery_function() const = 0;
+
   std::string
   get_name() const
   {
@@ -168,7 +197,15 @@ protected:
 }; // ConnectorModel
 
 
-template < typename ConnectionT >
+/**
+ * ConnectorModel for connections of type ConnectionT.
+ *
+ * ConnectorT is the type of Connector that stores the connections of
+ * this model on each thread. By default connections are stored as array
+ * of structs in Connector< ConnectionT >; models registered with
+ * register_soa_connection_model() use SoAConnector< ConnectionT >.
+ */
+template < typename ConnectionT, typename ConnectorT = Connector< ConnectionT > >
 class GenericConnectorModel : public ConnectorModel
 {
 private:
@@ -179,6 +216,9 @@ private:
   ConnectionT default_connection_;
   rport receptor_type_;
 
+  //! delivers spikes through Connectors of this synapse type
+  SpikeDeliveryFunction spike_delivery_function_;
+
 public:
   GenericConnectorModel( const std::string name,
     bool is_primary,
@@ -195,6 +235,7 @@ public:
         requires_clopath_archiving,
         requires_urbanczik_archiving )
     , receptor_type_( 0 )
+    , spike_delivery_function_( &ConnectorT::deliver_spike )
   {
   }
 
@@ -204,6 +245,7 @@ public:
     , pev_( cm.pev_ )
     , default_connection_( cm.default_connection_ )
     , receptor_type_( cm.receptor_type_ )
+    , spike_delivery_function_( cm.spike_delivery_function_ )
   {
   }
 
@@ -258,6 +300,15 @@ public:
     return prototype_events;
   }
 
+  SpikeDeliveryFunction get_spike_delivery_function() const;
+
+  /**
+   * Deliver spikes to targets of type TargetT without dynamic dispatch,
+   * see ModelManager::register_spike_delivery_target().
+   */
+  template < typename TargetT >
+  void set_spike_delivery_target();
+
 private:
   void used_default_delay();
 
@@ -61,16 +61,31 @@ namespace nest
 //   return cm.get_default_connection().get_syn_id_delay();
 // }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 ConnectorModel*
-GenericConnectorModel< ConnectionT >::clone( std::string name ) const
+GenericConnectorModel< ConnectionT, ConnectorT >::clone( std::string name ) const
 {
   return new GenericConnectorModel( *this, name ); // calls copy construtor
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
+SpikeDeliveryFunction
+GenericConnectorModel< ConnectionT, ConnectorT >::get_spike_delivery_function() const
+{
+  return spike_delivery_function_;
+}
+
+template < typename ConnectionT, typename ConnectorT >
+template < typename TargetT >
+void
+GenericConnectorModel< ConnectionT, ConnectorT >::set_spike_delivery_target()
+{
+  spike_delivery_function_ = &ConnectorT::template deliver_spike_to< TargetT >;
+}
+
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::calibrate( const TimeConverter& tc )
+GenericConnectorModel< ConnectionT, ConnectorT >::calibrate( const TimeConverter& tc )
 {
   // calibrate the delay of the default properties here
   default_connection_.calibrate( tc );
@@ -82,9 +97,9 @@ GenericConnectorModel< ConnectionT >::calibrate( const TimeConverter& tc )
   cp_.calibrate( tc );
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::get_status( DictionaryDatum& d ) const
+GenericConnectorModel< ConnectionT, ConnectorT >::get_status( DictionaryDatum& d ) const
 {
   // first get properties common to all synapses
   // these are stored only once (not within each Connection)
@@ -99,9 +114,9 @@ GenericConnectorModel< ConnectionT >::get_status( DictionaryDatum& d ) const
   ( *d )[ names::has_delay ] = has_delay_;
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::set_status( const DictionaryDatum& d )
+GenericConnectorModel< ConnectionT, ConnectorT >::set_status( const DictionaryDatum& d )
 {
   updateValue< long >( d, names::receptor_type, receptor_type_ );
 #ifdef HAVE_MUSIC
@@ -127,9 +142,9 @@ GenericConnectorModel< ConnectionT >::set_status( const DictionaryDatum& d )
   default_delay_needs_check_ = true;
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::used_default_delay()
+GenericConnectorModel< ConnectionT, ConnectorT >::used_default_delay()
 {
   // if not used before, check now. Solves bug #138, MH 08-01-08
   // replaces whole delay checking for the default delay, see bug #217
@@ -169,16 +184,16 @@ GenericConnectorModel< ConnectionT >::used_default_delay()
   }
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::set_syn_id( synindex syn_id )
+GenericConnectorModel< ConnectionT, ConnectorT >::set_syn_id( synindex syn_id )
 {
   default_connection_.set_syn_id( syn_id );
 }
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::add_connection( Node& src,
+GenericConnectorModel< ConnectionT, ConnectorT >::add_connection( Node& src,
   Node& tgt,
   std::vector< ConnectorBase* >& thread_local_connectors,
   const synindex syn_id,
@@ -252,9 +267,9 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
 }
 
 
-template < typename ConnectionT >
+template < typename ConnectionT, typename ConnectorT >
 void
-GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
+GenericConnectorModel< ConnectionT, ConnectorT >::add_connection_( Node& src,
   Node& tgt,
   std::vector< ConnectorBase* >& thread_local_connectors,
   const synindex syn_id,
@@ -267,7 +282,7 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
   {
     // No homogeneous Connector with this syn_id exists, we need to create a new
     // homogeneous Connector.
-    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+    thread_local_connectors[ syn_id ] = new ConnectorT( syn_id );
   }
 
   ConnectorBase* connector = thread_local_connectors[ syn_id ];
@@ -276,7 +291,7 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
 
   assert( connector != 0 );
 
-  Connector< ConnectionT >* vc = static_cast< Connector< ConnectionT >* >( connector );
+  ConnectorT* vc = static_cast< ConnectorT* >( connector );
   vc->push_back( connection );
 }
 
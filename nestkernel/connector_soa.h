@@ -0,0 +1,659 @@
+/*
+ *  connector_soa.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONNECTOR_SOA_H
+#define CONNECTOR_SOA_H
+
+// Includes from libnestutil:
+#include "block_vector.h"
+#include "sort.h"
+
+// Includes from nestkernel:
+#include "connector_base.h"
+#include "connector_model.h"
+#include "kernel_manager.h"
+#include "syn_id_delay.h"
+
+namespace nest
+{
+
+/**
+ * Weight column of SoAConnector for synapse types that store an
+ * individual weight per connection. Requires ConnectionT to provide
+ * get_weight() and set_weight().
+ */
+class SoAIndividualWeights
+{
+private:
+  BlockVector< double > weights_;
+
+public:
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& c )
+  {
+    weights_.push_back( c.get_weight() );
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index lcid, ConnectionT& c ) const
+  {
+    c.set_weight( weights_[ lcid ] );
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index lcid, const ConnectionT& c )
+  {
+    weights_[ lcid ] = c.get_weight();
+  }
+
+  template < typename CommonPropertiesT >
+  double
+  get_weight( const index lcid, const CommonPropertiesT& ) const
+  {
+    return weights_[ lcid ];
+  }
+
+  double
+  get( const index lcid ) const
+  {
+    return weights_[ lcid ];
+  }
+
+  void
+  set( const index lcid, const double w )
+  {
+    weights_[ lcid ] = w;
+  }
+
+  void
+  erase( const index first )
+  {
+    weights_.erase( weights_.begin() + first, weights_.end() );
+  }
+
+  void
+  clear()
+  {
+    weights_.clear();
+  }
+};
+
+/**
+ * Weight column of SoAConnector for synapse types that use a weight
+ * common to all connections, which is taken from the common properties.
+ * Stores nothing per connection.
+ */
+class SoAHomogeneousWeights
+{
+public:
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& )
+  {
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index, ConnectionT& ) const
+  {
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index, const ConnectionT& )
+  {
+  }
+
+  template < typename CommonPropertiesT >
+  double
+  get_weight( const index, const CommonPropertiesT& cp ) const
+  {
+    return cp.get_weight();
+  }
+
+  double
+  get( const index ) const
+  {
+    return 0.0;
+  }
+
+  void
+  set( const index, const double )
+  {
+  }
+
+  void
+  erase( const index )
+  {
+  }
+
+  void
+  clear()
+  {
+  }
+};
+
+/**
+ * Homogeneous connector that stores the connections of one synapse type
+ * as structure of arrays instead of an array of ConnectionT objects.
+ *
+ * Target identifiers, delays and weights are kept in separate contiguous
+ * columns. The delay column holds SynIdDelay, which packs the delay in
+ * steps together with the flags for disabled connections and for
+ * connections whose source has more targets, such that following the
+ * targets of a source only reads four bytes per connection besides the
+ * data needed for delivery.
+ *
+ * This layout is only suitable for static synapse types, i.e., types
+ * that consist of nothing but target, delay and weight and whose send()
+ * forwards these unchanged. The weight column is selected by the
+ * connection type via the typedef SoAWeightsType. Connection objects are
+ * assembled from the columns only to read or write their status.
+ *
+ * @see ModelManager::register_soa_connection_model
+ */
+template < typename ConnectionT >
+class SoAConnector : public ConnectorBase
+{
+private:
+  typedef typename ConnectionT::TargetIdentifierType TargetIdentifierType;
+  typedef typename ConnectionT::CommonPropertiesType CommonPropertiesType;
+
+  BlockVector< TargetIdentifierType > targets_;
+  BlockVector< SynIdDelay > syn_id_delays_;
+  typename ConnectionT::SoAWeightsType weights_;
+  const synindex syn_id_;
+
+public:
+  explicit SoAConnector( const synindex syn_id )
+    : syn_id_( syn_id )
+  {
+  }
+
+  ~SoAConnector()
+  {
+    targets_.clear();
+    syn_id_delays_.clear();
+    weights_.clear();
+  }
+
+  synindex
+  get_syn_id() const
+  {
+    return syn_id_;
+  }
+
+  size_t
+  size() const
+  {
+    return targets_.size();
+  }
+
+  void
+  get_synapse_status( const thread tid, const index lcid, DictionaryDatum& dict ) const
+  {
+    assert( lcid < size() );
+
+    load_( lcid ).get_status( dict );
+
+    // get target node ID here, where tid is available
+    // necessary for hpc synapses using TargetIdentifierIndex
+    def< long >( dict, names::target, targets_[ lcid ].get_target_ptr( tid )->get_node_id() );
+  }
+
+  void
+  set_synapse_status( const index lcid, const DictionaryDatum& dict, ConnectorModel& cm )
+  {
+    assert( lcid < size() );
+
+    ConnectionT c = load_( lcid );
+    c.set_status( dict, cm );
+    store_( lcid, c );
+  }
+
+  void
+  push_back( const ConnectionT& c )
+  {
+    targets_.push_back( c.target_ );
+    syn_id_delays_.push_back( c.syn_id_delay_ );
+    weights_.push_back( c );
+  }
+
+  void
+  get_connection( const index source_node_id,
+    const index target_node_id,
+    const thread tid,
+    const index lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    // static synapses are unlabeled
+    if ( not syn_id_delays_[ lcid ].is_disabled() and synapse_label == UNLABELED_CONNECTION )
+    {
+      const index current_target_node_id = get_target_node_id( tid, lcid );
+      if ( current_target_node_id == target_node_id or target_node_id == 0 )
+      {
+        conns.push_back( ConnectionDatum( ConnectionID( source_node_id, current_target_node_id, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_connection_with_specified_targets( const index source_node_id,
+    const std::vector< size_t >& target_neuron_node_ids,
+    const thread tid,
+    const index lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    if ( not syn_id_delays_[ lcid ].is_disabled() and synapse_label == UNLABELED_CONNECTION )
+    {
+      const index current_target_node_id = get_target_node_id( tid, lcid );
+      if ( std::find( target_neuron_node_ids.begin(), target_neuron_node_ids.end(), current_target_node_id )
+        != target_neuron_node_ids.end() )
+      {
+        conns.push_back( ConnectionDatum( ConnectionID( source_node_id, current_target_node_id, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_all_connections( const index source_node_id,
+    const index target_node_id,
+    const thread tid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      get_connection( source_node_id, target_node_id, tid, lcid, synapse_label, conns );
+    }
+  }
+
+  void
+  get_source_lcids( const thread tid, const index target_node_id, std::vector< index >& source_lcids ) const
+  {
+    for ( index lcid = 0; lcid < size(); ++lcid )
+    {
+      if ( get_target_node_id( tid, lcid ) == target_node_id and not syn_id_delays_[ lcid ].is_disabled() )
+      {
+        source_lcids.push_back( lcid );
+      }
+    }
+  }
+
+  void
+  get_target_node_ids( const thread tid,
+    const index start_lcid,
+    const std::string& post_synaptic_element,
+    std::vector< index >& target_node_ids ) const
+  {
+    index lcid = start_lcid;
+    while ( true )
+    {
+      Node* const target = targets_[ lcid ].get_target_ptr( tid );
+      if ( target->get_synaptic_elements( post_synaptic_element ) != 0.0 and not syn_id_delays_[ lcid ].is_disabled() )
+      {
+        target_node_ids.push_back( target->get_node_id() );
+      }
+
+      if ( not syn_id_delays_[ lcid ].source_has_more_targets() )
+      {
+        break;
+      }
+
+      ++lcid;
+    }
+  }
+
+  index
+  get_target_node_id( const thread tid, const unsigned int lcid ) const
+  {
+    return targets_[ lcid ].get_target_ptr( tid )->get_node_id();
+  }
+
+  void
+  send_to_all( const thread tid, const std::vector< ConnectorModel* >& cm, Event& e )
+  {
+    const CommonPropertiesType& cp = get_common_properties_( cm );
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      e.set_port( lcid );
+      assert( not syn_id_delays_[ lcid ].is_disabled() );
+      send_( tid, lcid, e, cp );
+    }
+  }
+
+  void
+  send_to_all( const thread tid, const std::vector< ConnectorModel* >& cm, SpikeEvent& se )
+  {
+    const CommonPropertiesType& cp = get_common_properties_( cm );
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      se.set_port( lcid );
+      assert( not syn_id_delays_[ lcid ].is_disabled() );
+      send_( tid, lcid, se, cp );
+    }
+  }
+
+  void
+  send_to_all( const thread, const std::vector< ConnectorModel* >&, SpikeEvent3& se )
+  {
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      se.set_port( lcid );
+      assert( not syn_id_delays_[ lcid ].is_disabled() );
+    }
+  }
+
+  index
+  send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e )
+  {
+    return send_to_targets_( tid, lcid, cm, e );
+  }
+
+  index
+  send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, SpikeEvent& e )
+  {
+    return send_to_targets_( tid, lcid, cm, e );
+  }
+
+  /**
+   * Send SpikeEvent e to all targets of the source at position lcid of
+   * connector c, which must be a SoAConnector< ConnectionT >.
+   *
+   * @see Connector::deliver_spike
+   */
+  static index
+  deliver_spike( ConnectorBase* c,
+    const thread tid,
+    const index lcid,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e )
+  {
+    return static_cast< SoAConnector< ConnectionT >* >( c )->send_to_targets_( tid, lcid, cm, e );
+  }
+
+  void
+  send_weight_event( const thread tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp )
+  {
+    send_weight_event_( tid, lcid, e, cp );
+  }
+
+  void
+  send_weight_event( const thread tid, const unsigned int lcid, SpikeEvent& e, const CommonSynapseProperties& cp )
+  {
+    send_weight_event_( tid, lcid, e, cp );
+  }
+
+  void
+  trigger_update_weight( const long,
+    const thread,
+    const std::vector< spikecounter >&,
+    const double,
+    const std::vector< ConnectorModel* >& )
+  {
+    throw IllegalConnection( "Connection does not support updates that are triggered by a volume transmitter." );
+  }
+
+  void
+  sort_connections( BlockVector< Source >& sources )
+  {
+    // sort a permutation alongside the sources and apply it to all
+    // columns afterwards
+    BlockVector< index > permutation;
+    for ( index lcid = 0; lcid < size(); ++lcid )
+    {
+      permutation.push_back( lcid );
+    }
+    nest::sort( sources, permutation );
+    permute_( permutation );
+  }
+
+  void
+  set_source_has_more_targets( const index lcid, const bool has_more_targets )
+  {
+    syn_id_delays_[ lcid ].set_source_has_more_targets( has_more_targets );
+  }
+
+  index
+  find_first_target( const thread tid, const index start_lcid, const index target_node_id ) const
+  {
+    index lcid = start_lcid;
+    while ( true )
+    {
+      if ( get_target_node_id( tid, lcid ) == target_node_id and not syn_id_delays_[ lcid ].is_disabled() )
+      {
+        return lcid;
+      }
+
+      if ( not syn_id_delays_[ lcid ].source_has_more_targets() )
+      {
+        return invalid_index;
+      }
+
+      ++lcid;
+    }
+  }
+
+  index
+  find_matching_target( const thread tid, const std::vector< index >& matching_lcids, const index target_node_id ) const
+  {
+    for ( size_t i = 0; i < matching_lcids.size(); ++i )
+    {
+      if ( get_target_node_id( tid, matching_lcids[ i ] ) == target_node_id )
+      {
+        return matching_lcids[ i ];
+      }
+    }
+
+    return invalid_index;
+  }
+
+  void
+  disable_connection( const index lcid )
+  {
+    assert( not syn_id_delays_[ lcid ].is_disabled() );
+    syn_id_delays_[ lcid ].disable();
+  }
+
+  void
+  append_to_snapshot( const thread tid,
+    const std::vector< ConnectorModel* >& cm,
+    const BlockVector< Source >& sources,
+    ConnectivitySnapshot& snapshot ) const
+  {
+    assert( sources.size() == targets_.size() );
+    const CommonPropertiesType& cp = get_common_properties_( cm );
+
+    for ( index lcid = 0; lcid < targets_.size(); ++lcid )
+    {
+      snapshot.push_back( sources[ lcid ].get_node_id(),
+        targets_[ lcid ].get_target_ptr( tid )->get_thread_lid(),
+        targets_[ lcid ].get_rport(),
+        weights_.get_weight( lcid, cp ),
+        syn_id_delays_[ lcid ].delay,
+        syn_id_ );
+    }
+  }
+
+  bool
+  supports_snapshot_delivery( const std::vector< ConnectorModel* >& cm ) const
+  {
+    // SoA connectors only hold static synapses, whose send() forwards
+    // the stored values, but weight recording needs the full send path
+    return not get_common_properties_( cm ).get_weight_recorder();
+  }
+
+  void
+  remove_disabled_connections( const index first_disabled_index )
+  {
+    assert( syn_id_delays_[ first_disabled_index ].is_disabled() );
+    targets_.erase( targets_.begin() + first_disabled_index, targets_.end() );
+    syn_id_delays_.erase( syn_id_delays_.begin() + first_disabled_index, syn_id_delays_.end() );
+    weights_.erase( first_disabled_index );
+  }
+
+private:
+  const CommonPropertiesType&
+  get_common_properties_( const std::vector< ConnectorModel* >& cm ) const
+  {
+    return static_cast< GenericConnectorModel< ConnectionT, SoAConnector< ConnectionT > >* >( cm[ syn_id_ ] )
+      ->get_common_properties();
+  }
+
+  /**
+   * Assemble the connection at position lcid from the columns.
+   */
+  ConnectionT
+  load_( const index lcid ) const
+  {
+    ConnectionT c;
+    c.target_ = targets_[ lcid ];
+    c.syn_id_delay_ = syn_id_delays_[ lcid ];
+    weights_.load( lcid, c );
+    return c;
+  }
+
+  /**
+   * Write the connection c back to the columns at position lcid.
+   */
+  void
+  store_( const index lcid, const ConnectionT& c )
+  {
+    targets_[ lcid ] = c.target_;
+    syn_id_delays_[ lcid ] = c.syn_id_delay_;
+    weights_.store( lcid, c );
+  }
+
+  /**
+   * Reorder all columns such that position lcid holds the entry that was
+   * at position permutation[ lcid ] before. Follows the cycles of the
+   * permutation and resets visited entries of permutation to identity.
+   */
+  void
+  permute_( BlockVector< index >& permutation )
+  {
+    for ( index lcid = 0; lcid < permutation.size(); ++lcid )
+    {
+      if ( permutation[ lcid ] == lcid )
+      {
+        continue;
+      }
+
+      const TargetIdentifierType target = targets_[ lcid ];
+      const SynIdDelay syn_id_delay = syn_id_delays_[ lcid ];
+      const double weight = weights_.get( lcid );
+
+      index current = lcid;
+      while ( true )
+      {
+        const index next = permutation[ current ];
+        permutation[ current ] = current;
+        if ( next == lcid )
+        {
+          targets_[ current ] = target;
+          syn_id_delays_[ current ] = syn_id_delay;
+          weights_.set( current, weight );
+          break;
+        }
+        targets_[ current ] = targets_[ next ];
+        syn_id_delays_[ current ] = syn_id_delays_[ next ];
+        weights_.set( current, weights_.get( next ) );
+        current = next;
+      }
+    }
+  }
+
+  template < typename EventT >
+  void
+  send_( const thread tid, const index lcid, EventT& e, const CommonPropertiesType& cp )
+  {
+    e.set_weight( weights_.get_weight( lcid, cp ) );
+    e.set_delay_steps( syn_id_delays_[ lcid ].delay );
+    e.set_receiver( *targets_[ lcid ].get_target_ptr( tid ) );
+    e.set_rport( targets_[ lcid ].get_rport() );
+    e();
+  }
+
+  template < typename EventT >
+  index
+  send_to_targets_( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, EventT& e )
+  {
+    const CommonPropertiesType& cp = get_common_properties_( cm );
+
+    index lcid_offset = 0;
+
+    while ( true )
+    {
+      const SynIdDelay syn_id_delay = syn_id_delays_[ lcid + lcid_offset ];
+
+      e.set_port( lcid + lcid_offset );
+      if ( not syn_id_delay.is_disabled() )
+      {
+        send_( tid, lcid + lcid_offset, e, cp );
+        send_weight_event_( tid, lcid + lcid_offset, e, cp );
+      }
+      if ( not syn_id_delay.source_has_more_targets() )
+      {
+        break;
+      }
+      ++lcid_offset;
+    }
+
+    return 1 + lcid_offset; // event was delivered to at least one target
+  }
+
+  template < typename EventT >
+  void
+  send_weight_event_( const thread tid, const unsigned int lcid, EventT& e, const CommonSynapseProperties& cp )
+  {
+    // If the pointer to the receiver node in the event is invalid,
+    // the event was not sent, and a WeightRecorderEvent is therefore not created.
+    if ( cp.get_weight_recorder() and e.receiver_is_valid() )
+    {
+      // Create new event to record the weight and copy relevant content.
+      WeightRecorderEvent wr_e;
+      wr_e.set_port( e.get_port() );
+      wr_e.set_rport( e.get_rport() );
+      wr_e.set_stamp( e.get_stamp() );
+      wr_e.set_sender( e.get_sender() );
+      wr_e.set_sender_node_id( kernel().connection_manager.get_source_node_id( tid, syn_id_, lcid ) );
+      wr_e.set_weight( e.get_weight() );
+      wr_e.set_delay_steps( e.get_delay_steps() );
+      // Set weight_recorder as receiver
+      index wr_node_id = cp.get_wr_node_id();
+      Node* wr_node = kernel().node_manager.get_node_or_proxy( wr_node_id, tid );
+      wr_e.set_receiver( *wr_node );
+      // Put the node_id of the postsynaptic node as receiver node ID
+      wr_e.set_receiver_node_id( e.get_receiver_node_id() );
+      wr_e();
+    }
+  }
+};
+
+} // of namespace nest
+
+#endif /* #ifndef CONNECTOR_SOA_H */
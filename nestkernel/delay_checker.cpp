@@ -33,6 +33,7 @@
 nest::DelayChecker::DelayChecker()
   : min_delay_( Time::pos_inf() )
   , max_delay_( Time::neg_inf() )
+  , min_connection_delay_( Time::pos_inf() )
   , user_set_delay_extrema_( false )
   , freeze_delay_update_( false )
 {
@@ -41,11 +42,13 @@ nest::DelayChecker::DelayChecker()
 nest::DelayChecker::DelayChecker( const DelayChecker& cr )
   : min_delay_( cr.min_delay_ )
   , max_delay_( cr.max_delay_ )
+  , min_connection_delay_( cr.min_connection_delay_ )
   , user_set_delay_extrema_( cr.user_set_delay_extrema_ )
   , freeze_delay_update_( cr.freeze_delay_update_ )
 {
   min_delay_.calibrate(); // in case of change in resolution
   max_delay_.calibrate();
+  min_connection_delay_.calibrate();
 }
 
 void
@@ -55,6 +58,7 @@ nest::DelayChecker::calibrate( const TimeConverter& tc )
   // network elements present.
   min_delay_ = tc.from_old_tics( min_delay_.get_tics() );
   max_delay_ = tc.from_old_tics( max_delay_.get_tics() );
+  min_connection_delay_ = tc.from_old_tics( min_connection_delay_.get_tics() );
 }
 
 void
@@ -145,6 +149,11 @@ nest::DelayChecker::assert_valid_delay_ms( double requested_new_delay )
   const bool new_min_delay = new_delay < min_delay_.get_steps();
   const bool new_max_delay = new_delay > max_delay_.get_steps();
 
+  if ( new_delay < min_connection_delay_.get_steps() and not freeze_delay_update_ )
+  {
+    min_connection_delay_ = Time( Time::step( new_delay ) );
+  }
+
   if ( new_min_delay )
   {
     if ( user_set_delay_extrema_ )
@@ -210,6 +219,11 @@ nest::DelayChecker::assert_two_valid_delays_steps( delay new_delay1, delay new_d
   const bool new_min_delay = ldelay < min_delay_.get_steps();
   const bool new_max_delay = hdelay > max_delay_.get_steps();
 
+  if ( ldelay < min_connection_delay_.get_steps() and not freeze_delay_update_ )
+  {
+    min_connection_delay_ = Time( Time::step( ldelay ) );
+  }
+
   if ( new_min_delay )
   {
     if ( user_set_delay_extrema_ )
@@ -43,6 +43,12 @@ public:
 
   const Time& get_max_delay() const;
 
+  /**
+   * Return the smallest delay of all created synapses. Differs from
+   * get_min_delay() if the user has set the delay extrema.
+   */
+  const Time& get_min_connection_delay() const;
+
   /**
    * This method freezes the min/ max delay update in SetDefaults of connections
    * method. This is used, when the delay of default connections in the
@@ -88,6 +94,8 @@ public:
 private:
   Time min_delay_;              //!< Minimal delay of all created synapses.
   Time max_delay_;              //!< Maximal delay of all created synapses.
+  Time min_connection_delay_;   //!< Minimal delay of all created synapses,
+                                //!< also if the user set the delay extrema.
   bool user_set_delay_extrema_; //!< Flag indicating if the user set the delay
                                 //!< extrema.
   bool freeze_delay_update_;
@@ -105,6 +113,12 @@ DelayChecker::get_max_delay() const
   return max_delay_;
 }
 
+inline const Time&
+DelayChecker::get_min_connection_delay() const
+{
+  return min_connection_delay_;
+}
+
 inline bool
 DelayChecker::get_user_set_delay_extrema() const
 {
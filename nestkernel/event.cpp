@@ -58,6 +58,12 @@ void SpikeEvent::operator()()
   //p3->iaf_psc_alpha::handle_non_virtual(*this);
 }
 
+void BufferedSpikeEvent::operator()()
+{
+  const BufferedSpike spike = { receiver_, w_, offset_, stamp_, sender_node_id_, d_, rp_, multiplicity_ };
+  buffer_->push_back( spike );
+}
+
 void WeightRecorderEvent::operator()()
 {
   receiver_->handle( *this );
@@ -466,6 +466,68 @@ public:
   void operator()();
 };
 
+/**
+ * Spike event for receivers of type TargetT.
+ *
+ * operator() calls TargetT::handle() without dynamic dispatch, so that
+ * delivery of an event whose type is known at the call site requires no
+ * indirect call and can be inlined. The receiver must be of exactly
+ * type TargetT, not of a type derived from it.
+ */
+template < typename TargetT >
+class TypedSpikeEvent : public SpikeEvent
+{
+public:
+  void operator()() final;
+};
+
+template < typename TargetT >
+inline void
+TypedSpikeEvent< TargetT >::operator()()
+{
+  static_cast< TargetT* >( receiver_ )->TargetT::handle( *this );
+}
+
+/**
+ * Compact record of a spike event collected by BufferedSpikeEvent.
+ * Holds all properties of a SpikeEvent that synapses and spike
+ * delivery set.
+ */
+struct BufferedSpike
+{
+  Node* receiver_;
+  double weight_;
+  double offset_;
+  Time stamp_;
+  index sender_node_id_;
+  delay delay_steps_;
+  rport rport_;
+  int multiplicity_;
+};
+
+/**
+ * Spike event that is collected instead of being handled.
+ *
+ * Synapses prepare the event as usual, but operator() appends a
+ * BufferedSpike to a buffer instead of calling receiver->handle().
+ * This allows the EventDeliveryManager to hand spikes to their
+ * receivers in batches grouped by target node.
+ */
+class BufferedSpikeEvent : public SpikeEvent
+{
+public:
+  explicit BufferedSpikeEvent( std::vector< BufferedSpike >& buffer );
+  void operator()();
+
+private:
+  std::vector< BufferedSpike >* buffer_; //!< buffer receiving records of this event
+};
+
+inline BufferedSpikeEvent::BufferedSpikeEvent( std::vector< BufferedSpike >& buffer )
+  : buffer_( &buffer )
+{
+}
+
 /**
  * Event for firing rate information.
  * Used to send firing rate from one node to the next.
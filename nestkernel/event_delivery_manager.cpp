@@ -23,9 +23,10 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // max_element, rotate, sort
 #include <iostream>
-#include <numeric> // accumulate
+#include <limits>
+#include <numeric> // accumulate, partial_sum
 #include <memory>
 // Includes from libnestutil:
 #include "logging.h"
@@ -37,6 +38,7 @@
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "send_buffer_position.h"
+#include "spike_data_encoding.h"
 #include "source.h"
 #include "vp_manager.h"
 #include "vp_manager_impl.h"
@@ -44,21 +46,41 @@
 // Includes from sli:
 #include "dictutils.h"
 
-#include "target_identifier.h"
-#include "static_synapse.h"
-//#include "stdp_pl_connection_hom.h"
-//#include "connector_base.h"
-//#include "libnestutil/block_vector.h"
-
-//#include "iaf_psc_alpha.h"
 namespace nest
 {
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , batched_spike_delivery_( false )
+  , offload_spike_delivery_( false )
+  , pipelined_spike_exchange_( false )
+  , has_pending_spike_data_( false )
+  , encode_spike_data_( false )
+  , counted_target_data_( false )
+  , target_data_chunk_size_( 0 )
   , moduli_()
   , slice_moduli_()
   , spike_register_()
   , off_grid_spike_register_()
+  , pending_spike_register_()
+  , pending_off_grid_spike_register_()
+  , spike_data_send_counts_()
+  , spike_data_send_displacements_()
+  , spike_data_send_positions_()
+  , spike_data_recv_counts_()
+  , spike_data_recv_displacements_()
+  , send_buffer_encoded_spike_data_()
+  , recv_buffer_encoded_spike_data_()
+  , encoded_spike_data_send_counts_()
+  , encoded_spike_data_send_displacements_()
+  , encoded_spike_data_recv_counts_()
+  , encoded_spike_data_recv_displacements_()
+  , target_data_remaining_counts_()
+  , target_data_send_counts_()
+  , target_data_send_displacements_()
+  , target_data_send_positions_()
+  , target_data_recv_counts_()
+  , target_data_recv_displacements_()
+  , has_more_target_data_( false )
   , send_buffer_secondary_events_()
   , recv_buffer_secondary_events_()
   , local_spike_counter_()
@@ -68,9 +90,16 @@ EventDeliveryManager::EventDeliveryManager()
   , recv_buffer_off_grid_spike_data_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
+  , sorted_spike_data_()
+  , sorted_spike_data_begin_()
+  , spike_delivery_functions_()
+  , batched_spike_events_()
+  , batched_spike_events_begin_()
+  , batched_spike_events_order_()
   , buffer_size_target_data_has_changed_( false )
   , buffer_size_spike_data_has_changed_( false )
   , decrease_buffer_size_spike_data_( true )
+  , spike_buffer_overflow_rounds_( 0 )
   , gather_completed_checker_()
 {
 }
@@ -91,9 +120,40 @@ EventDeliveryManager::initialize()
   reset_timers_for_dynamics();
   spike_register_.resize( num_threads );
   off_grid_spike_register_.resize( num_threads );
+  pending_spike_register_.resize( num_threads );
+  pending_off_grid_spike_register_.resize( num_threads );
+  spike_data_send_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  spike_data_send_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  spike_data_send_positions_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  spike_data_recv_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  spike_data_recv_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  encoded_spike_data_send_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  encoded_spike_data_send_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  encoded_spike_data_recv_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  encoded_spike_data_recv_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  slice_spike_data_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_remaining_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_send_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_send_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_send_positions_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_recv_counts_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  target_data_recv_displacements_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+  batched_spike_events_.resize( num_threads );
+  batched_spike_events_begin_.resize( num_threads );
+  batched_spike_events_order_.resize( num_threads );
+#ifdef HAVE_OFFLOAD
+  offloaded_spikes_.resize( num_threads );
+#endif
   gather_completed_checker_.initialize( num_threads, false );
   // Ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  batched_spike_delivery_ = false;
+  offload_spike_delivery_ = false;
+  pipelined_spike_exchange_ = false;
+  has_pending_spike_data_ = false;
+  encode_spike_data_ = false;
+  counted_target_data_ = false;
+  target_data_chunk_size_ = 0;
   buffer_size_target_data_has_changed_ = false;
   buffer_size_spike_data_has_changed_ = false;
   decrease_buffer_size_spike_data_ = true;
@@ -101,32 +161,28 @@ EventDeliveryManager::initialize()
 #pragma omp parallel
   {
     const thread tid = kernel().vp_manager.get_thread_id();
-    spike_register_[ tid ].resize( num_threads,
-      std::vector< std::vector< Target > >( kernel().connection_manager.get_min_delay(), std::vector< Target >() ) );
-
-    off_grid_spike_register_[ tid ].resize( num_threads,
-      std::vector< std::vector< OffGridTarget > >( kernel().connection_manager.get_min_delay(),
-                                              std::vector< OffGridTarget >() ) );
-  } // of omp parallel
+    spike_register_[ tid ].clear();
+    spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
 
-#pragma omp target enter data map(to: this[0:1])
+    off_grid_spike_register_[ tid ].clear();
+    off_grid_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
 
-}
+    pending_spike_register_[ tid ].clear();
+    pending_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
 
-void
-EventDeliveryManager::map_1()
-{
-	int len = moduli_.size();
-	//nest::delay *p = &moduli_[0];	
-//#pragma omp target enter data map(to: p[0:len])
+    pending_off_grid_spike_register_[ tid ].clear();
+    pending_off_grid_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
+  } // of omp parallel
 }
 
 void
 EventDeliveryManager::finalize()
 {
   // clear the spike buffers
-  std::vector< std::vector< std::vector< std::vector< Target > > > >().swap( spike_register_ );
-  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap( off_grid_spike_register_ );
+  std::vector< SpikeRegister< Target > >().swap( spike_register_ );
+  std::vector< SpikeRegister< OffGridTarget > >().swap( off_grid_spike_register_ );
+  std::vector< SpikeRegister< Target > >().swap( pending_spike_register_ );
+  std::vector< SpikeRegister< OffGridTarget > >().swap( pending_off_grid_spike_register_ );
 
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
@@ -134,20 +190,82 @@ EventDeliveryManager::finalize()
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  sorted_spike_data_.clear();
+  sorted_spike_data_begin_.clear();
+  spike_delivery_functions_.clear();
+  batched_spike_events_.clear();
+  batched_spike_events_begin_.clear();
+  batched_spike_events_order_.clear();
+#ifdef HAVE_OFFLOAD
+  offloaded_spikes_.clear();
+#endif
+}
+
+void
+EventDeliveryManager::prepare()
+{
+  // synapse prototypes are identical across threads up to their common
+  // properties, so the delivery functions of thread 0 serve all threads
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( 0 );
+
+  spike_delivery_functions_.resize( cm.size() );
+  for ( synindex syn_id = 0; syn_id < cm.size(); ++syn_id )
+  {
+    spike_delivery_functions_[ syn_id ] = cm[ syn_id ]->get_spike_delivery_function();
+  }
 }
 
 void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >( dict, names::batched_spike_delivery, batched_spike_delivery_ );
+
+  bool offload_spike_delivery = offload_spike_delivery_;
+  updateValue< bool >( dict, names::offload_spike_delivery, offload_spike_delivery );
+#ifndef HAVE_OFFLOAD
+  if ( offload_spike_delivery )
+  {
+    throw KernelException( "NEST was built without offloading. Reconfigure with -Dwith-offload=ON." );
+  }
+#endif
+  offload_spike_delivery_ = offload_spike_delivery;
+
+  updateValue< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange_ );
+  updateValue< bool >( dict, names::encode_spike_data, encode_spike_data_ );
+  updateValue< bool >( dict, names::counted_target_data, counted_target_data_ );
+
+  long target_data_chunk_size = target_data_chunk_size_;
+  if ( updateValue< long >( dict, names::target_data_chunk_size, target_data_chunk_size ) )
+  {
+    if ( target_data_chunk_size < 0 )
+    {
+      throw BadProperty( "target_data_chunk_size must be non-negative." );
+    }
+    target_data_chunk_size_ = target_data_chunk_size;
+  }
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict, names::batched_spike_delivery, batched_spike_delivery_ );
+  def< bool >( dict, names::offload_spike_delivery, offload_spike_delivery_ );
+  def< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange_ );
+  def< bool >( dict, names::encode_spike_data, encode_spike_data_ );
+  def< bool >( dict, names::counted_target_data, counted_target_data_ );
+  def< long >( dict, names::target_data_chunk_size, target_data_chunk_size_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
+  def< unsigned long >( dict, names::spike_buffer_overflow_rounds, spike_buffer_overflow_rounds_ );
+  def< size_t >( dict,
+    names::spike_buffer_memory,
+    ( send_buffer_spike_data_.capacity() + recv_buffer_spike_data_.capacity() ) * sizeof( SpikeData )
+      + ( send_buffer_off_grid_spike_data_.capacity() + recv_buffer_off_grid_spike_data_.capacity() )
+        * sizeof( OffGridSpikeData )
+      + ( send_buffer_encoded_spike_data_.capacity() + recv_buffer_encoded_spike_data_.capacity() )
+        * sizeof( unsigned int ) );
 
 #ifdef TIMER_DETAILED
   def< double >( dict, names::time_collocate_spike_data, sw_collocate_spike_data_.elapsed() );
@@ -285,6 +403,7 @@ EventDeliveryManager::reset_counters()
   {
     ( *it ) = 0;
   }
+  spike_buffer_overflow_rounds_ = 0;
 }
 
 void
@@ -350,133 +469,647 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
   std::vector< SpikeDataT >& send_buffer,
   std::vector< SpikeDataT >& recv_buffer )
 {
+  if ( kernel().mpi_manager.get_spike_exchange() == MPIManager::SPIKE_EXCHANGE_ALLTOALLV )
+  {
+    gather_counted_spike_data_( tid, send_buffer, recv_buffer );
+    return;
+  }
+
+  if ( pipelined_spike_exchange_ )
+  {
+    complete_spike_data_( tid, send_buffer, recv_buffer );
+    start_spike_data_( tid, send_buffer, recv_buffer );
+    return;
+  }
+
   // Assume all threads have some work to do
   gather_completed_checker_[ tid ].set_false();
   assert( gather_completed_checker_.all_false() );
 
-  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
-
   // Assume a single gather round
   decrease_buffer_size_spike_data_ = true;
 
+  // Group the spikes registered during update by reading thread and
+  // lag; the implicit barrier at the beginning of the first gather
+  // round ensures all registers are frozen before they are read.
+  freeze_spike_register_( tid );
+
   while ( gather_completed_checker_.any_false() )
   {
     // Assume this is the last gather round and change to false
     // otherwise
     gather_completed_checker_[ tid ].set_true();
 
+    collocate_spike_data_round_( tid, spike_register_, off_grid_spike_register_, send_buffer );
+
+    exchange_spike_data_round_( tid, send_buffer, recv_buffer );
+
+    deliver_spike_data_round_( tid, recv_buffer, false );
+  } // of while
+
 #pragma omp single
+  {
+    update_buffer_size_spike_data_();
+  } // of omp single; implicit barrier
+
+  reset_spike_register_( tid );
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::gather_counted_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  freeze_spike_register_( tid );
+
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_collocate_spike_data_.start();
+  }
+#endif
+
+  // Each rank is assigned to exactly one reading thread, so threads
+  // count and write disjoint parts of the send buffer.
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    spike_data_send_counts_[ rank ] = 0;
+  }
+#pragma omp barrier
+  count_spike_data_( tid, spike_register_ );
+  if ( off_grid_spiking_ )
+  {
+    count_spike_data_( tid, off_grid_spike_register_ );
+  }
+#pragma omp barrier
+
+#pragma omp single
+  {
+    std::partial_sum( spike_data_send_counts_.begin(),
+      spike_data_send_counts_.end() - 1,
+      spike_data_send_displacements_.begin() + 1 );
+
+    const size_t send_size = spike_data_send_displacements_.back() + spike_data_send_counts_.back();
+    // MPI needs valid buffers also if nothing is sent
+    if ( send_size + 1 > send_buffer.size() )
+    {
+      send_buffer.resize( send_size + 1 );
+    }
+
+    if ( encode_spike_data_ )
+    {
+      // reserve space for the encoding of each chunk; the receive
+      // counts are only known after the exchange
+      for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+      {
+        encoded_spike_data_send_counts_[ rank ] =
+          get_max_encoded_spike_data_size< SpikeDataT >( spike_data_send_counts_[ rank ] );
+      }
+      std::partial_sum( encoded_spike_data_send_counts_.begin(),
+        encoded_spike_data_send_counts_.end() - 1,
+        encoded_spike_data_send_displacements_.begin() + 1 );
+      const size_t encoded_send_size =
+        encoded_spike_data_send_displacements_.back() + encoded_spike_data_send_counts_.back();
+      if ( encoded_send_size > send_buffer_encoded_spike_data_.size() )
+      {
+        send_buffer_encoded_spike_data_.resize( encoded_send_size );
+      }
+    }
+    else
     {
-      if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
+      kernel().mpi_manager.communicate_counts( spike_data_send_counts_, spike_data_recv_counts_ );
+
+      std::partial_sum( spike_data_recv_counts_.begin(),
+        spike_data_recv_counts_.end() - 1,
+        spike_data_recv_displacements_.begin() + 1 );
+
+      const size_t recv_size = spike_data_recv_displacements_.back() + spike_data_recv_counts_.back();
+      if ( recv_size + 1 > recv_buffer.size() )
       {
-        resize_send_recv_buffers_spike_data_();
-        buffer_size_spike_data_has_changed_ = false;
+        recv_buffer.resize( recv_size + 1 );
       }
+    }
+  } // of omp single; implicit barrier
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    spike_data_send_positions_[ rank ] = spike_data_send_displacements_[ rank ];
+  }
+  write_spike_data_( tid, spike_register_, send_buffer );
+  if ( off_grid_spiking_ )
+  {
+    write_spike_data_( tid, off_grid_spike_register_, send_buffer );
+  }
+#pragma omp barrier
+
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_collocate_spike_data_.stop();
+    sw_deliver_spike_data_.start();
+  }
+#endif
+
+  if ( encode_spike_data_ )
+  {
+    communicate_encoded_spike_data_( tid, send_buffer, recv_buffer );
+  }
+  else
+  {
+#pragma omp single
+    {
+#ifdef TIMER_DETAILED
+      sw_communicate_spike_data_.start();
+#endif
+      kernel().mpi_manager.communicate_Alltoallv( send_buffer,
+        spike_data_send_counts_,
+        spike_data_send_displacements_,
+        recv_buffer,
+        spike_data_recv_counts_,
+        spike_data_recv_displacements_ );
+#ifdef TIMER_DETAILED
+      sw_communicate_spike_data_.stop();
+#endif
     } // of omp single; implicit barrier
+  }
+
+  if ( not kernel().connection_manager.use_compressed_spikes() )
+  {
+#pragma omp single
+    {
+      sort_spike_data_( recv_buffer );
+    } // of omp single; implicit barrier
+  }
+
+  // all spikes arrive in a single round
+  deliver_events_( tid, recv_buffer, false );
+
 #ifdef TIMER_DETAILED
-    if ( tid == 0 )
+  if ( tid == 0 )
+  {
+    sw_deliver_spike_data_.stop();
+  }
+#endif
+
+  reset_spike_register_( tid );
+}
+
+template < typename TargetT >
+void
+EventDeliveryManager::count_spike_data_( const thread tid, std::vector< SpikeRegister< TargetT > >& spike_register )
+{
+  for ( typename std::vector< SpikeRegister< TargetT > >::iterator it = spike_register.begin();
+        it != spike_register.end();
+        ++it )
+  {
+    if ( it->empty() )
     {
-      sw_collocate_spike_data_.start();
+      continue;
     }
-#endif
 
-    // Need to get new positions in case buffer size has changed
-    SendBufferPosition send_buffer_position(
-      assigned_ranks, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+    for ( unsigned int lag = 0; lag < it->get_num_lags(); ++lag )
+    {
+      for ( typename SpikeRegister< TargetT >::iterator iiit = it->begin( tid, lag ); iiit < it->end( tid, lag );
+            ++iiit )
+      {
+        ++spike_data_send_counts_[ iiit->get_rank() ];
+      }
+    }
+  }
+}
 
-    // Collocate spikes to send buffer
-    const bool collocate_completed =
-      collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer );
-    gather_completed_checker_[ tid ].logical_and( collocate_completed );
+template < typename TargetT, typename SpikeDataT >
+void
+EventDeliveryManager::write_spike_data_( const thread tid,
+  std::vector< SpikeRegister< TargetT > >& spike_register,
+  std::vector< SpikeDataT >& send_buffer )
+{
+  for ( typename std::vector< SpikeRegister< TargetT > >::iterator it = spike_register.begin();
+        it != spike_register.end();
+        ++it )
+  {
+    if ( it->empty() )
+    {
+      continue;
+    }
 
-    if ( off_grid_spiking_ )
+    for ( unsigned int lag = 0; lag < it->get_num_lags(); ++lag )
     {
-      const bool collocate_completed_off_grid = collocate_spike_data_buffers_(
-        tid, assigned_ranks, send_buffer_position, off_grid_spike_register_, send_buffer );
-      gather_completed_checker_[ tid ].logical_and( collocate_completed_off_grid );
+      for ( typename SpikeRegister< TargetT >::iterator iiit = it->begin( tid, lag ); iiit < it->end( tid, lag );
+            ++iiit )
+      {
+        send_buffer[ spike_data_send_positions_[ iiit->get_rank() ]++ ].set(
+          iiit->get_tid(), iiit->get_syn_id(), iiit->get_lcid(), lag, iiit->get_offset() );
+      }
     }
+  }
+}
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::communicate_encoded_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    SpikeDataT* const chunk = &send_buffer[ spike_data_send_displacements_[ rank ] ];
+    encoded_spike_data_send_counts_[ rank ] = encode_spike_data( chunk,
+      chunk + spike_data_send_counts_[ rank ],
+      &send_buffer_encoded_spike_data_[ encoded_spike_data_send_displacements_[ rank ] ] );
+  }
 #pragma omp barrier
-    // Set markers to signal end of valid spikes, and remove spikes
-    // from register that have been collected in send buffer.
-    set_end_and_invalid_markers_( assigned_ranks, send_buffer_position, send_buffer );
-    clean_spike_register_( tid );
 
-    // If we do not have any spikes left, set corresponding marker in
-    // send buffer.
-    if ( gather_completed_checker_.all_true() )
+#pragma omp single
+  {
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_.start();
+#endif
+    kernel().mpi_manager.communicate_counts(
+      encoded_spike_data_send_counts_, encoded_spike_data_recv_counts_ );
+
+    std::partial_sum( encoded_spike_data_recv_counts_.begin(),
+      encoded_spike_data_recv_counts_.end() - 1,
+      encoded_spike_data_recv_displacements_.begin() + 1 );
+    const size_t encoded_recv_size =
+      encoded_spike_data_recv_displacements_.back() + encoded_spike_data_recv_counts_.back();
+    if ( encoded_recv_size > recv_buffer_encoded_spike_data_.size() )
+    {
+      recv_buffer_encoded_spike_data_.resize( encoded_recv_size );
+    }
+
+    kernel().mpi_manager.communicate_Alltoallv( send_buffer_encoded_spike_data_,
+      encoded_spike_data_send_counts_,
+      encoded_spike_data_send_displacements_,
+      recv_buffer_encoded_spike_data_,
+      encoded_spike_data_recv_counts_,
+      encoded_spike_data_recv_displacements_ );
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_.stop();
+#endif
+
+    // every encoded chunk starts with its number of entries
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      spike_data_recv_counts_[ rank ] =
+        get_num_encoded_spike_data( &recv_buffer_encoded_spike_data_[ encoded_spike_data_recv_displacements_[ rank ] ] );
+    }
+    std::partial_sum( spike_data_recv_counts_.begin(),
+      spike_data_recv_counts_.end() - 1,
+      spike_data_recv_displacements_.begin() + 1 );
+    const size_t recv_size = spike_data_recv_displacements_.back() + spike_data_recv_counts_.back();
+    if ( recv_size + 1 > recv_buffer.size() )
+    {
+      recv_buffer.resize( recv_size + 1 );
+    }
+  } // of omp single; implicit barrier
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    decode_spike_data( &recv_buffer_encoded_spike_data_[ encoded_spike_data_recv_displacements_[ rank ] ],
+      &recv_buffer[ spike_data_recv_displacements_[ rank ] ] );
+  }
+#pragma omp barrier
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::start_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  // Hand the spikes of this slice over to the pending registers, such
+  // that nodes register the spikes of the next slice while these are
+  // in flight.
+  std::swap( spike_register_[ tid ], pending_spike_register_[ tid ] );
+  std::swap( off_grid_spike_register_[ tid ], pending_off_grid_spike_register_[ tid ] );
+  pending_spike_register_[ tid ].freeze();
+  pending_off_grid_spike_register_[ tid ].freeze();
+
+  // The outcome of this first round is evaluated by
+  // complete_spike_data_() at the end of the next slice.
+  gather_completed_checker_[ tid ].set_true();
+  decrease_buffer_size_spike_data_ = true;
+
+  collocate_spike_data_round_( tid, pending_spike_register_, pending_off_grid_spike_register_, send_buffer );
+
+#pragma omp single
+  {
+    communicate_spike_data_( send_buffer, recv_buffer, true );
+    has_pending_spike_data_ = true;
+  } // of omp single; implicit barrier
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  if ( not has_pending_spike_data_ )
+  {
+    return;
+  }
+
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_communicate_spike_data_.start();
+  }
+#endif
+#pragma omp single
+  {
+    kernel().mpi_manager.wait_spike_data();
+  } // of omp single; implicit barrier
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_communicate_spike_data_.stop();
+  }
+#endif
+
+  // Deliver the first round and, if some rank could not send all its
+  // spikes, the remaining rounds of the previous slice.
+  deliver_spike_data_round_( tid, recv_buffer, true );
+
+  while ( gather_completed_checker_.any_false() )
+  {
+    gather_completed_checker_[ tid ].set_true();
+
+    collocate_spike_data_round_( tid, pending_spike_register_, pending_off_grid_spike_register_, send_buffer );
+
+    exchange_spike_data_round_( tid, send_buffer, recv_buffer );
+
+    deliver_spike_data_round_( tid, recv_buffer, true );
+  } // of while
+
+  pending_spike_register_[ tid ].clear();
+  pending_off_grid_spike_register_[ tid ].clear();
+
+#pragma omp single
+  {
+    update_buffer_size_spike_data_();
+    has_pending_spike_data_ = false;
+  } // of omp single; implicit barrier
+}
+
+void
+EventDeliveryManager::update_buffer_size_spike_data_()
+{
+  if ( not kernel().mpi_manager.adaptive_spike_buffers() )
+  {
+    return;
+  }
+
+  if ( kernel().mpi_manager.predict_buffer_size_spike_data() )
+  {
+    const size_t max_spike_count = *std::max_element( slice_spike_data_counts_.begin(), slice_spike_data_counts_.end() );
+    std::fill( slice_spike_data_counts_.begin(), slice_spike_data_counts_.end(), 0 );
+    if ( kernel().mpi_manager.update_buffer_size_spike_data( max_spike_count, not decrease_buffer_size_spike_data_ ) )
     {
-      // Needs to be called /after/ set_end_and_invalid_markers_.
-      set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
+      buffer_size_spike_data_has_changed_ = true;
+    }
+  }
+  else if ( decrease_buffer_size_spike_data_ )
+  {
+    kernel().mpi_manager.decrease_buffer_size_spike_data();
+  }
+}
+
+void
+EventDeliveryManager::complete_pending_spike_data( const thread tid )
+{
+  if ( off_grid_spiking_ )
+  {
+    complete_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    complete_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_round_( const thread tid,
+  std::vector< SpikeRegister< Target > >& spike_register,
+  std::vector< SpikeRegister< OffGridTarget > >& off_grid_spike_register,
+  std::vector< SpikeDataT >& send_buffer )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+#pragma omp single
+  {
+    if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
+    {
+      resize_send_recv_buffers_spike_data_();
+      buffer_size_spike_data_has_changed_ = false;
+    }
+    if ( kernel().mpi_manager.thread_parallel_spike_exchange() )
+    {
+      kernel().mpi_manager.prepare_thread_parallel_spike_exchange();
+    }
+  } // of omp single; implicit barrier
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_collocate_spike_data_.start();
+  }
+#endif
+
+  // Need to get new positions in case buffer size has changed
+  SendBufferPosition send_buffer_position(
+    assigned_ranks, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  // Collocate spikes to send buffer
+  const bool collocate_completed =
+    collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, spike_register, send_buffer );
+  gather_completed_checker_[ tid ].logical_and( collocate_completed );
+
+  if ( off_grid_spiking_ )
+  {
+    const bool collocate_completed_off_grid = collocate_spike_data_buffers_(
+      tid, assigned_ranks, send_buffer_position, off_grid_spike_register, send_buffer );
+    gather_completed_checker_[ tid ].logical_and( collocate_completed_off_grid );
+  }
+
 #pragma omp barrier
+  // Set markers to signal end of valid spikes, and remove spikes
+  // from register that have been collected in send buffer.
+  set_end_and_invalid_markers_( assigned_ranks, send_buffer_position, send_buffer );
+  spike_register[ tid ].clean();
+  if ( kernel().mpi_manager.predict_buffer_size_spike_data() )
+  {
+    for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+    {
+      slice_spike_data_counts_[ rank ] += send_buffer_position.idx( rank ) - send_buffer_position.begin( rank );
     }
+  }
+  off_grid_spike_register[ tid ].clean();
+
+  // If we do not have any spikes left, set corresponding marker in
+  // send buffer.
+  if ( gather_completed_checker_.all_true() )
+  {
+    // Needs to be called /after/ set_end_and_invalid_markers_.
+    set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
+#pragma omp barrier
+  }
 
 #ifdef TIMER_DETAILED
-    if ( tid == 0 )
+  if ( tid == 0 )
+  {
+    sw_collocate_spike_data_.stop();
+  }
+#endif
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::communicate_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  const bool nonblocking )
+{
+#ifdef TIMER_DETAILED
+  sw_communicate_spike_data_.start();
+#endif
+  if ( off_grid_spiking_ )
+  {
+    if ( nonblocking )
     {
-      sw_collocate_spike_data_.stop();
-      sw_communicate_spike_data_.start();
+      kernel().mpi_manager.start_communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
+    }
+  }
+  else
+  {
+    if ( nonblocking )
+    {
+      kernel().mpi_manager.start_communicate_spike_data_Alltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
     }
+  }
+#ifdef TIMER_DETAILED
+  sw_communicate_spike_data_.stop();
 #endif
+}
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::exchange_spike_data_round_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  if ( not kernel().mpi_manager.thread_parallel_spike_exchange() )
+  {
 // Communicate spikes using a single thread.
 #pragma omp single
     {
-      if ( off_grid_spiking_ )
-      {
-        kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
-      }
-      else
-      {
-        kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
-      }
+      communicate_spike_data_( send_buffer, recv_buffer, false );
     } // of omp single; implicit barrier
+    return;
+  }
 
 #ifdef TIMER_DETAILED
-    if ( tid == 0 )
-    {
-      sw_communicate_spike_data_.stop();
-      sw_deliver_spike_data_.start();
-    }
+  if ( tid == 0 )
+  {
+    sw_communicate_spike_data_.start();
+  }
 #endif
 
-    // Deliver spikes from receive buffer to ring buffers.
-    const bool deliver_completed = deliver_events_( tid, recv_buffer );
-    gather_completed_checker_[ tid ].logical_and( deliver_completed );
+  // Each thread starts sending as soon as the chunks of its assigned
+  // ranks are collocated and only waits for the chunks of these ranks.
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+  kernel().mpi_manager.communicate_spike_data_of_ranks(
+    tid, send_buffer, recv_buffer, assigned_ranks.begin, assigned_ranks.end );
+
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_communicate_spike_data_.stop();
+  }
+#endif
+
+  // All chunks must have arrived before any thread delivers them
+#pragma omp barrier
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_spike_data_round_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const bool deferred )
+{
+#ifdef TIMER_DETAILED
+  if ( tid == 0 )
+  {
+    sw_deliver_spike_data_.start();
+  }
+#endif
+
+  // Group received spikes by target thread and synapse type.
+  if ( not kernel().connection_manager.use_compressed_spikes() )
+  {
+#pragma omp single
+    {
+      sort_spike_data_( recv_buffer );
+    } // of omp single; implicit barrier
+  }
+
+  // Deliver spikes from receive buffer to ring buffers.
+  const bool deliver_completed = deliver_events_( tid, recv_buffer, deferred );
+  gather_completed_checker_[ tid ].logical_and( deliver_completed );
 
 // Exit gather loop if all local threads and remote processes are
 // done.
 #pragma omp barrier
 
+  // With sparse exchange, ranks only see the complete markers of
+  // their neighbours, so all ranks need to agree on another round.
+  if ( kernel().mpi_manager.get_spike_exchange() == MPIManager::SPIKE_EXCHANGE_SPARSE )
+  {
+    const bool locally_completed = gather_completed_checker_.all_true();
+#pragma omp single
+    {
+      if ( kernel().mpi_manager.any_true( not locally_completed ) )
+      {
+        gather_completed_checker_[ tid ].set_false();
+      }
+    } // of omp single; implicit barrier
+  }
+
 #ifdef TIMER_DETAILED
-    if ( tid == 0 )
-    {
-      sw_deliver_spike_data_.stop();
-    }
+  if ( tid == 0 )
+  {
+    sw_deliver_spike_data_.stop();
+  }
 #endif
 
-    // Resize mpi buffers, if necessary and allowed.
-    if ( gather_completed_checker_.any_false() and kernel().mpi_manager.adaptive_spike_buffers() )
-    {
+  // Resize mpi buffers, if necessary and allowed.
+  if ( gather_completed_checker_.any_false() )
+  {
 #pragma omp single
+    {
+      ++spike_buffer_overflow_rounds_;
+      if ( kernel().mpi_manager.adaptive_spike_buffers() )
       {
         buffer_size_spike_data_has_changed_ = kernel().mpi_manager.increase_buffer_size_spike_data();
         decrease_buffer_size_spike_data_ = false;
       }
     }
+  }
 #pragma omp barrier
-
-  } // of while
-
-#pragma omp single
-  {
-    if ( decrease_buffer_size_spike_data_ and kernel().mpi_manager.adaptive_spike_buffers() )
-    {
-      kernel().mpi_manager.decrease_buffer_size_spike_data();
-    }
-  } // of omp single; implicit barrier
-
-  reset_spike_register_( tid );
 }
 
 template < typename TargetT, typename SpikeDataT >
@@ -484,7 +1117,7 @@ bool
 EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   const AssignedRanks& assigned_ranks,
   SendBufferPosition& send_buffer_position,
-  std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register,
+  std::vector< SpikeRegister< TargetT > >& spike_register,
   std::vector< SpikeDataT >& send_buffer )
 {
   reset_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
@@ -493,20 +1126,21 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   // not be fit into the MPI buffer.
   bool is_spike_register_empty = true;
 
-  // First dimension: loop over writing thread
-  for (
-    typename std::vector< std::vector< std::vector< std::vector< TargetT > > > >::iterator it = spike_register.begin();
-    it != spike_register.end();
-    ++it )
+  // Loop over registers of all writing threads
+  for ( typename std::vector< SpikeRegister< TargetT > >::iterator it = spike_register.begin();
+        it != spike_register.end();
+        ++it )
   {
-    // Second dimension: fixed reading thread
+    if ( it->empty() )
+    {
+      continue;
+    }
 
-    // Third dimension: loop over lags
-    for ( unsigned int lag = 0; lag < ( *it )[ tid ].size(); ++lag )
+    // Loop over lags, with fixed reading thread
+    for ( unsigned int lag = 0; lag < it->get_num_lags(); ++lag )
     {
-      // Fourth dimension: loop over entries
-      for ( typename std::vector< TargetT >::iterator iiit = ( *it )[ tid ][ lag ].begin();
-            iiit < ( *it )[ tid ][ lag ].end();
+      // Loop over entries
+      for ( typename SpikeRegister< TargetT >::iterator iiit = it->begin( tid, lag ); iiit < it->end( tid, lag );
             ++iiit )
       {
         assert( not iiit->is_processed() );
@@ -599,172 +1233,438 @@ EventDeliveryManager::set_complete_marker_spike_data_( const AssignedRanks& assi
 
 template < typename SpikeDataT >
 bool
-EventDeliveryManager::deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::deliver_events_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const bool deferred )
 {
   const unsigned int send_recv_count_spike_data_per_rank =
     kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
   const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
+  const std::vector< ConnectorBase* >& connectors = kernel().connection_manager.get_thread_local_connections( tid );
 
-  ConnectorModel* cmarray[cm.size()];
-  for ( int i=0; i < cm.size(); i++)
+  // the table is built in prepare(), no synapse models can be added since
+  assert( spike_delivery_functions_.size() == cm.size() );
+
+  bool are_others_completed = true;
+
+  // deliver only at end of time slice, or one slice later if deferred
+  assert( deferred or kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+
+  // in batched mode, synapses append their spikes to a per-thread
+  // buffer, which is handed to the receivers in chunks
+  SpikeEvent immediate_se;
+  BufferedSpikeEvent batched_se( batched_spike_events_[ tid ] );
+  SpikeEvent& se = batched_spike_delivery_ ? batched_se : immediate_se;
+
+  // prepare Time objects for every possible time stamp within min_delay_;
+  // deferred spikes were emitted in the slice before the current one
+  const Time slice_origin = deferred
+    ? kernel().simulation_manager.get_clock() - Time::step( kernel().connection_manager.get_min_delay() )
+    : kernel().simulation_manager.get_clock();
+  std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
+  for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
   {
-    cmarray[i] = cm[i];
+    prepared_timestamps[ lag ] = slice_origin + Time::step( lag + 1 );
   }
 
-  bool are_others_completed = true;
+  // with exactly sized chunks, all spikes arrive in a single round
+  if ( kernel().mpi_manager.get_spike_exchange() != MPIManager::SPIKE_EXCHANGE_ALLTOALLV )
+  {
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      // check last entry for completed marker; needs to be done before
+      // checking invalid marker to assure that this is always read
+      if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
+      {
+        are_others_completed = false;
+      }
+    }
+  }
 
-  // deliver only at end of time slice
-  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+  if ( not kernel().connection_manager.use_compressed_spikes() )
+  {
+    // the receive buffer has been grouped by sort_spike_data_, so this
+    // thread only visits its own entries, one synapse type at a time
+    const size_t num_syn_ids = cm.size();
+    for ( synindex syn_id = 0; syn_id < num_syn_ids; ++syn_id )
+    {
+      const std::vector< size_t >::iterator begin =
+        sorted_spike_data_.begin() + sorted_spike_data_begin_[ tid * num_syn_ids + syn_id ];
+      const std::vector< size_t >::iterator end =
+        sorted_spike_data_.begin() + sorted_spike_data_begin_[ tid * num_syn_ids + syn_id + 1 ];
+      if ( begin == end )
+      {
+        continue;
+      }
 
-  SpikeEvent se;
+      // Visit connections in storage order. Ties are broken by buffer
+      // position to keep multiple spikes of one source in the order in
+      // which they were sent.
+      std::sort( begin,
+        end,
+        [&recv_buffer]( const size_t lhs, const size_t rhs )
+        {
+          const index lcid_lhs = recv_buffer[ lhs ].get_lcid();
+          const index lcid_rhs = recv_buffer[ rhs ].get_lcid();
+          return lcid_lhs < lcid_rhs or ( lcid_lhs == lcid_rhs and lhs < rhs );
+        } );
 
-  // prepare Time objects for every possible time stamp within min_delay_
-  //std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
-  Time prepared_timestamps[ kernel().connection_manager.get_min_delay() ];
-  for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
+      ConnectorBase* const connector = connectors[ syn_id ];
+
+#ifdef HAVE_OFFLOAD
+      if ( offload_spike_delivery_ and connector->supports_snapshot_delivery( cm ) )
+      {
+        deliver_offloaded_spikes_( tid, syn_id, begin, end, recv_buffer, prepared_timestamps, se );
+        continue;
+      }
+#endif
+
+      const SpikeDeliveryFunction deliver_spike = spike_delivery_functions_[ syn_id ];
+
+      for ( std::vector< size_t >::const_iterator it = begin; it != end; ++it )
+      {
+        const SpikeDataT& spike_data = recv_buffer[ *it ];
+
+        se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+        se.set_offset( spike_data.get_offset() );
+
+        const index lcid = spike_data.get_lcid();
+        const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, lcid );
+        se.set_sender_node_id( source_node_id );
+
+        ( *deliver_spike )( connector, tid, lcid, cm, se );
+
+        if ( batched_spike_delivery_
+          and batched_spike_events_[ tid ].size() >= batched_spike_events_chunk_size_ )
+        {
+          deliver_batched_spike_events_( tid );
+        }
+      }
+    }
+
+    if ( batched_spike_delivery_ )
+    {
+      deliver_batched_spike_events_( tid );
+    }
+  }
+  else
   {
-    prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      size_t begin;
+      size_t end;
+      get_spike_data_chunk_( rank, begin, end );
+
+      // continue with next rank if no spikes were sent by this rank
+      if ( begin == end or recv_buffer[ begin ].is_invalid_marker() )
+      {
+        continue;
+      }
+
+      for ( size_t pos = begin; pos < end; ++pos )
+      {
+        const SpikeDataT& spike_data = recv_buffer[ pos ];
+
+        se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+        se.set_offset( spike_data.get_offset() );
+
+        // for compressed spikes lcid holds the index in the
+        // compressed_spike_data structure, which maps it to the
+        // connections of the source on this thread
+        const synindex syn_id = spike_data.get_syn_id();
+        const LcidSpan& span =
+          kernel().connection_manager.get_compressed_spike_data( tid, syn_id, spike_data.get_lcid() );
+        if ( not span.empty() )
+        {
+          const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, span.begin );
+          se.set_sender_node_id( source_node_id );
+
+          // connections of one source are consecutive and terminated
+          // by source_has_more_targets, so the delivery function visits
+          // exactly the span
+          const index num_delivered =
+            ( *spike_delivery_functions_[ syn_id ] )( connectors[ syn_id ], tid, span.begin, cm, se );
+          assert( num_delivered == span.end - span.begin );
+          ( void ) num_delivered;
+
+          if ( batched_spike_delivery_
+            and batched_spike_events_[ tid ].size() >= batched_spike_events_chunk_size_ )
+          {
+            deliver_batched_spike_events_( tid );
+          }
+        }
+
+        // break if this was the last valid entry from this rank
+        if ( spike_data.is_end_marker() )
+        {
+          break;
+        }
+      }
+    }
+
+    if ( batched_spike_delivery_ )
+    {
+      deliver_batched_spike_events_( tid );
+    }
   }
 
-  //std::cout << "::value_type " << sizeof(typename std::vector<SpikeDataT>::value_type) << std::endl;
-  //std::cout << "SpikeData ::value_type " << sizeof(std::vector<SpikeData>::value_type) << std::endl;
-  //std::cout << "sizeof(SpikeData) " << sizeof(SpikeData) << std::endl;
-  int recv_buffer_size = recv_buffer.size();
-  SpikeDataT recv_buffer_a[recv_buffer_size];
-  for ( int i=0; i < recv_buffer_size; i++ )
+  return are_others_completed;
+}
+
+#ifdef HAVE_OFFLOAD
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_offloaded_spikes_( const thread tid,
+  const synindex syn_id,
+  const std::vector< size_t >::const_iterator begin,
+  const std::vector< size_t >::const_iterator end,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const std::vector< Time >& prepared_timestamps,
+  SpikeEvent& se )
+{
+  const ConnectivitySnapshot& snapshot = kernel().connection_manager.get_connectivity_snapshot( tid );
+  OffloadedSpikes& spikes = offloaded_spikes_[ tid ];
+
+  const size_t num_spikes = end - begin;
+  spikes.lcids_.resize( num_spikes );
+  spikes.begin_.resize( num_spikes + 1 );
+  for ( size_t i = 0; i < num_spikes; ++i )
   {
-    recv_buffer_a[i] = recv_buffer[i];
+    spikes.lcids_[ i ] = recv_buffer[ *( begin + i ) ].get_lcid();
   }
 
-  WeightRecorderEvent *wr_e= new WeightRecorderEvent();
-  //std::cout << "wr_e pointer " << wr_e << std::endl;
-  ConnectionManager *p = &kernel().connection_manager;
-  // debug
-  for (int i =0;i<100;i++) {
-    auto *tmp = p->get_ptrConnectorBase(tid, i);
-    if (tmp) {
-       std::cout << " " << i << " " << typeid(tmp).name() << std::endl;
+  // The snapshot columns are mapped to the device while the snapshot is
+  // valid, so the map clauses below do not copy them. Connections of one
+  // source are stored consecutively, so the targets of a spike are the
+  // entries following its lcid that share its source.
+  const size_t snapshot_size = snapshot.size();
+  const size_t first_connection = snapshot.get_offset( syn_id );
+  const size_t end_connection = first_connection + snapshot.get_num_connections( syn_id );
+  const index* const sources = snapshot.get_source_node_ids();
+  const index* const lcids = spikes.lcids_.data();
+  size_t* const num_targets = spikes.begin_.data();
+
+#pragma omp target teams distribute parallel for map( to : sources[ 0 : snapshot_size ], lcids[ 0 : num_spikes ] ) \
+  map( from : num_targets[ 0 : num_spikes ] )
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    const size_t first = first_connection + lcids[ i ];
+    size_t last = first + 1;
+    while ( last < end_connection and sources[ last ] == sources[ first ] )
+    {
+      ++last;
     }
+    num_targets[ i ] = last - first;
   }
-  auto *myp75 = static_cast<Connector<static_synapse<TargetIdentifierPtrRport>> *>(p->get_ptrConnectorBase(tid, 75));
-  assert(myp75);
-  auto *myp76 = static_cast<Connector<static_synapse<TargetIdentifierPtrRport>> *>(p->get_ptrConnectorBase(tid, 76));
-  assert(myp76);
-  //auto *myp2 = static_cast<Connector<STDPPLConnectionHom<TargetIdentifierPtrRport>> *>(p->get_ptrConnectorBase(tid, 42));
-  //std::cout << "pointer " << p->get_ptrConnectorBase(tid, 72) << std::endl;
-  //StaticConnection<TargetIdentifierPtrRport>::CommonPropertiesType *tmp1[100];
 
-  //std::cout << "recv_buffer_a ptr " << recv_buffer_a << std::endl;
-  //std::cout << "SpikeDataT size " << sizeof(SpikeDataT) << std::endl;
-  //std::cout << "The size " << sizeof(recv_buffer_a[0]) * recv_buffer_size << std::endl;
-  //std::cout << "recv_buffer size " << recv_buffer_size << std::endl;
-  //std::cout << "cmarray address " << cmarray << std::endl;
-  //std::cout << "my thread id " << tid << std::endl;
+  // turn the counts into start positions in the gathered columns
+  size_t total_num_targets = 0;
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    const size_t n = spikes.begin_[ i ];
+    spikes.begin_[ i ] = total_num_targets;
+    total_num_targets += n;
+  }
+  spikes.begin_[ num_spikes ] = total_num_targets;
+
+  spikes.targets_.resize( total_num_targets );
+  spikes.rports_.resize( total_num_targets );
+  spikes.weights_.resize( total_num_targets );
+  spikes.delays_.resize( total_num_targets );
+
+  const index* const targets = snapshot.get_targets();
+  const rport* const rports = snapshot.get_rports();
+  const double* const weights = snapshot.get_weights();
+  const delay* const delays = snapshot.get_delays();
+  const size_t* const spike_begin = spikes.begin_.data();
+  index* const spike_targets = spikes.targets_.data();
+  rport* const spike_rports = spikes.rports_.data();
+  double* const spike_weights = spikes.weights_.data();
+  delay* const spike_delays = spikes.delays_.data();
+
+#pragma omp target teams distribute parallel for map( to : targets[ 0 : snapshot_size ], \
+  rports[ 0 : snapshot_size ],                                                           \
+  weights[ 0 : snapshot_size ],                                                          \
+  delays[ 0 : snapshot_size ],                                                           \
+  lcids[ 0 : num_spikes ],                                                               \
+  spike_begin[ 0 : num_spikes + 1 ] )                                                    \
+  map( from : spike_targets[ 0 : total_num_targets ],                                    \
+    spike_rports[ 0 : total_num_targets ],                                               \
+    spike_weights[ 0 : total_num_targets ],                                              \
+    spike_delays[ 0 : total_num_targets ] )
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    const size_t first = first_connection + lcids[ i ];
+    for ( size_t j = spike_begin[ i ]; j < spike_begin[ i + 1 ]; ++j )
+    {
+      const size_t k = first + j - spike_begin[ i ];
+      spike_targets[ j ] = targets[ k ];
+      spike_rports[ j ] = rports[ k ];
+      spike_weights[ j ] = weights[ k ];
+      spike_delays[ j ] = delays[ k ];
+    }
+  }
 
-  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  for ( size_t i = 0; i < num_spikes; ++i )
   {
-    // check last entry for completed marker; needs to be done before
-    // checking invalid marker to assure that this is always read
-    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
+    const SpikeDataT& spike_data = recv_buffer[ *( begin + i ) ];
+
+    se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+    se.set_offset( spike_data.get_offset() );
+    se.set_sender_node_id( sources[ first_connection + lcids[ i ] ] );
+
+    for ( size_t j = spike_begin[ i ]; j < spike_begin[ i + 1 ]; ++j )
     {
-      are_others_completed = false;
+      se.set_port( lcids[ i ] + j - spike_begin[ i ] );
+      se.set_weight( spike_weights[ j ] );
+      se.set_delay_steps( spike_delays[ j ] );
+      se.set_receiver( *kernel().node_manager.thread_lid_to_node( tid, spike_targets[ j ] ) );
+      se.set_rport( spike_rports[ j ] );
+      se();
     }
 
-    // continue with next rank if no spikes were sent by this rank
-    if ( recv_buffer[ rank * send_recv_count_spike_data_per_rank ].is_invalid_marker() )
+    if ( batched_spike_delivery_ and batched_spike_events_[ tid ].size() >= batched_spike_events_chunk_size_ )
     {
-      continue;
+      deliver_batched_spike_events_( tid );
     }
+  }
+}
+#endif
+
+void
+EventDeliveryManager::deliver_batched_spike_events_( const thread tid )
+{
+  std::vector< BufferedSpike >& spikes = batched_spike_events_[ tid ];
+  if ( spikes.empty() )
+  {
+    return;
+  }
+
+  // Counting sort by thread-local id of the receiver. Counts are stored
+  // shifted by one, such that the prefix sum yields the first position
+  // of each node.
+  std::vector< size_t >& begin = batched_spike_events_begin_[ tid ];
+  begin.assign( kernel().node_manager.get_local_nodes( tid ).size() + 1, 0 );
+  for ( std::vector< BufferedSpike >::const_iterator it = spikes.begin(); it != spikes.end(); ++it )
+  {
+    ++begin[ it->receiver_->get_thread_lid() + 1 ];
+  }
+  std::partial_sum( begin.begin(), begin.end(), begin.begin() );
+
+  std::vector< size_t >& order = batched_spike_events_order_[ tid ];
+  order.resize( spikes.size() );
+  for ( size_t i = 0; i < spikes.size(); ++i )
+  {
+    order[ begin[ spikes[ i ].receiver_->get_thread_lid() ]++ ] = i;
+  }
 
-    // determine the loop count until end marker
-    unsigned int valid_ents = 0;
-    for ( unsigned int i = 0; i < send_recv_count_spike_data_per_rank; i++)
+  // Prefetch the receiver a few spikes ahead, such that its state,
+  // including the bookkeeping of its ring buffers, is in cache once it
+  // handles its spikes.
+  const size_t prefetch_distance = 4;
+  const size_t num_spikes = order.size();
+  SpikeEvent se;
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    if ( i + prefetch_distance < num_spikes )
     {
-      if (recv_buffer[ rank * send_recv_count_spike_data_per_rank + i ].is_end_marker()) {
-                 valid_ents = i;
-                   break;
-      }
+      __builtin_prefetch( spikes[ order[ i + prefetch_distance ] ].receiver_, 1 );
     }
-    SpikeData spike_data;
-    std::cout << "valid_ents " << valid_ents << std::endl;
 
-    // DO NOT REMOVE
-    // Don't forget the condition be checked with the =< operator,
-    // when valid_ents is used.
-    // DO NOT REMOVE
-    const long min_delay = kernel().connection_manager.get_min_delay();
+    const BufferedSpike& spike = spikes[ order[ i ] ];
+    se.set_receiver( *spike.receiver_ );
+    se.set_weight( spike.weight_ );
+    se.set_offset( spike.offset_ );
+    se.set_stamp( spike.stamp_ );
+    se.set_sender_node_id( spike.sender_node_id_ );
+    se.set_delay_steps( spike.delay_steps_ );
+    se.set_rport( spike.rport_ );
+    se.set_multiplicity( spike.multiplicity_ );
+    se();
+  }
+
+  spikes.clear();
+}
+
+void
+EventDeliveryManager::get_spike_data_chunk_( const thread rank, size_t& begin, size_t& end ) const
+{
+  if ( kernel().mpi_manager.get_spike_exchange() == MPIManager::SPIKE_EXCHANGE_ALLTOALLV )
+  {
+    begin = spike_data_recv_displacements_[ rank ];
+    end = begin + spike_data_recv_counts_[ rank ];
+  }
+  else
+  {
+    const size_t send_recv_count_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+    begin = rank * send_recv_count_per_rank;
+    end = begin + send_recv_count_per_rank;
+  }
+}
 
-#pragma omp target parallel for
-    for (int i=0;i<10;i++) {}
+template < typename SpikeDataT >
+void
+EventDeliveryManager::sort_spike_data_( const std::vector< SpikeDataT >& recv_buffer )
+{
+  const size_t num_syn_ids = kernel().model_manager.get_num_synapse_prototypes();
+  const size_t num_buckets = kernel().vp_manager.get_num_threads() * num_syn_ids;
 
-//#pragma omp target teams distribute parallel for map(to: recv_buffer_a[0:recv_buffer_size]) map(to: p[0:1]) map(to: myp75[0:1], myp76[0:1], prepared_timestamps[0:min_delay], valid_ents, send_recv_count_spike_data_per_rank, se) thread_limit(1024)
-#pragma omp target teams distribute parallel for map(to: recv_buffer_a[0:recv_buffer_size]) map(to: p[0:1]) map(to: se, prepared_timestamps[0:min_delay], valid_ents, send_recv_count_spike_data_per_rank, spike_data, rank, myp75[0:1], myp76[0:1]) thread_limit(1024)
-    for ( unsigned int i = 0; i <= valid_ents; i++ )
-    //for ( unsigned int i = 0; i < send_recv_count_spike_data_per_rank; ++i )
+  // Count entries per (tid, syn_id) bucket. Counts are stored shifted by
+  // one, such that the prefix sum yields the first position of each
+  // bucket.
+  sorted_spike_data_begin_.assign( num_buckets + 1, 0 );
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    size_t begin;
+    size_t end;
+    get_spike_data_chunk_( rank, begin, end );
+    if ( begin == end or recv_buffer[ begin ].is_invalid_marker() )
     {
-      spike_data = recv_buffer_a[ rank * send_recv_count_spike_data_per_rank + i ];
+      continue;
+    }
 
-      //const SpikeDataT& spike_data = recv_buffer_a[ rank * send_recv_count_spike_data_per_rank + i ];
-      se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
-      se.set_offset( spike_data.get_offset() );
+    for ( size_t pos = begin; pos < end; ++pos )
+    {
+      const SpikeDataT& spike_data = recv_buffer[ pos ];
+      ++sorted_spike_data_begin_[ spike_data.get_tid() * num_syn_ids + spike_data.get_syn_id() + 1 ];
 
-      //if ( not kernel().connection_manager.use_compressed_spikes() )
-      if (1)
+      if ( spike_data.is_end_marker() )
       {
-        if ( spike_data.get_tid() == tid )
-        {
-	  //printf("get_lag %u get_offset %f\n", spike_data.get_lag(), spike_data.get_offset());
-          const index syn_id = spike_data.get_syn_id();
-          const index lcid = spike_data.get_lcid();
-          //const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, lcid );
-          const index source_node_id = p->get_source_node_id_device( tid, syn_id, lcid);
-          //const index source_node_gid = 1;//p->get_source_node_id_device( tid, syn_id, lcid);
-
-          //printf("Target: syn_id %lu lcid %lu source_gid %lu\n", syn_id, lcid, source_node_gid);
-          se.set_sender_node_id( source_node_id );
-
-          //kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
-	  //int *wr_e = nullptr;
-          if (syn_id == 75) {
-		myp75->f(tid, lcid, cmarray, se);
-	  } else if (syn_id == 32) {
-		myp76->f(tid, lcid, cmarray, se);
-	  } else if (syn_id == 42) {
-		//myp2->f(tid, lcid, cmarray, se, wr_e);
-	  }
-        }
+        break;
       }
-      else
-      {
-        /*const index syn_id = spike_data.get_syn_id();
-        // for compressed spikes lcid holds the index in the
-        // compressed_spike_data structure
-        const index idx = spike_data.get_lcid();
-        const std::vector< SpikeData >& compressed_spike_data =
-        kernel().connection_manager.get_compressed_spike_data( syn_id, idx );
-        for ( auto it = compressed_spike_data.cbegin(); it != compressed_spike_data.cend(); ++it )
-        {
-          if ( it->get_tid() == tid )
-          {
-            const index lcid = it->get_lcid();
-            const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, lcid );
-            se.set_sender_node_id( source_node_id );
+    }
+  }
+  std::partial_sum( sorted_spike_data_begin_.begin(), sorted_spike_data_begin_.end(), sorted_spike_data_begin_.begin() );
 
-            kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
-          }
-        }*/
-      }
+  // Scatter buffer positions into their buckets. This advances the
+  // start of each bucket to the start of the next one, which is undone
+  // by shifting all starts by one afterwards.
+  sorted_spike_data_.resize( sorted_spike_data_begin_[ num_buckets ] );
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    size_t begin;
+    size_t end;
+    get_spike_data_chunk_( rank, begin, end );
+    if ( begin == end or recv_buffer[ begin ].is_invalid_marker() )
+    {
+      continue;
+    }
+
+    for ( size_t pos = begin; pos < end; ++pos )
+    {
+      const SpikeDataT& spike_data = recv_buffer[ pos ];
+      sorted_spike_data_[ sorted_spike_data_begin_[ spike_data.get_tid() * num_syn_ids + spike_data.get_syn_id() ]++ ] =
+        pos;
 
-      // break if this was the last valid entry from this rank
       if ( spike_data.is_end_marker() )
       {
-        printf("i is %d\n", i); 
-        //break;
+        break;
       }
     }
   }
-
-  return are_others_completed;
+  std::copy_backward(
+    sorted_spike_data_begin_.begin(), sorted_spike_data_begin_.end() - 1, sorted_spike_data_begin_.end() );
+  sorted_spike_data_begin_[ 0 ] = 0;
 }
 
 void
@@ -772,6 +1672,12 @@ EventDeliveryManager::gather_target_data( const thread tid )
 {
   assert( not kernel().connection_manager.is_source_table_cleared() );
 
+  if ( counted_target_data_ )
+  {
+    gather_counted_target_data_( tid );
+    return;
+  }
+
   // assume all threads have some work to do
   gather_completed_checker_[ tid ].set_false();
   assert( gather_completed_checker_.all_false() );
@@ -974,22 +1880,170 @@ nest::EventDeliveryManager::distribute_target_data_buffers_( const thread tid )
 }
 
 void
-EventDeliveryManager::resize_spike_register_( const thread tid )
+EventDeliveryManager::gather_counted_target_data_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
-        it != spike_register_[ tid ].end();
-        ++it )
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  kernel().connection_manager.prepare_target_table( tid );
+  kernel().connection_manager.reset_source_table_entry_point( tid );
+
+  // Each rank is assigned to exactly one thread, which counts the
+  // target data for it. Counting requires that no thread has started
+  // to process the source table.
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    target_data_remaining_counts_[ rank ] = 0;
+  }
+#pragma omp barrier
+  kernel().connection_manager.count_target_data( assigned_ranks.begin, assigned_ranks.end, target_data_remaining_counts_ );
+#pragma omp barrier
+
+  // the counts are converted to ints for MPI
+  const size_t max_chunk_size = std::numeric_limits< int >::max() / ( sizeof( TargetData ) / sizeof( unsigned int ) )
+    / kernel().mpi_manager.get_num_processes();
+  const size_t chunk_size =
+    target_data_chunk_size_ > 0 ? std::min( target_data_chunk_size_, max_chunk_size ) : max_chunk_size;
+
+  do
+  {
+#pragma omp single
+    {
+      for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+      {
+        target_data_send_counts_[ rank ] = std::min( target_data_remaining_counts_[ rank ], chunk_size );
+      }
+      kernel().mpi_manager.communicate_counts( target_data_send_counts_, target_data_recv_counts_ );
+
+      std::partial_sum( target_data_send_counts_.begin(),
+        target_data_send_counts_.end() - 1,
+        target_data_send_displacements_.begin() + 1 );
+      std::partial_sum( target_data_recv_counts_.begin(),
+        target_data_recv_counts_.end() - 1,
+        target_data_recv_displacements_.begin() + 1 );
+
+      const size_t send_size = target_data_send_displacements_.back() + target_data_send_counts_.back();
+      const size_t recv_size = target_data_recv_displacements_.back() + target_data_recv_counts_.back();
+      // MPI needs valid buffers also if nothing is sent
+      if ( send_size + 1 > send_buffer_target_data_.size() )
+      {
+        send_buffer_target_data_.resize( send_size + 1 );
+      }
+      if ( recv_size + 1 > recv_buffer_target_data_.size() )
+      {
+        recv_buffer_target_data_.resize( recv_size + 1 );
+      }
+    } // of omp single; implicit barrier
+
+    kernel().connection_manager.restore_source_table_entry_point( tid );
+    collocate_counted_target_data_( tid, assigned_ranks );
+    kernel().connection_manager.save_source_table_entry_point( tid );
+#pragma omp barrier
+    kernel().connection_manager.clean_source_table( tid );
+
+#pragma omp single
+    {
+      bool has_remaining_target_data = false;
+      for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+      {
+        target_data_remaining_counts_[ rank ] -= target_data_send_counts_[ rank ];
+        has_remaining_target_data = has_remaining_target_data or target_data_remaining_counts_[ rank ] > 0;
+      }
+      has_more_target_data_ = kernel().mpi_manager.any_true( has_remaining_target_data );
+
+#ifdef TIMER_DETAILED
+      sw_communicate_target_data_.start();
+#endif
+      kernel().mpi_manager.communicate_Alltoallv( send_buffer_target_data_,
+        target_data_send_counts_,
+        target_data_send_displacements_,
+        recv_buffer_target_data_,
+        target_data_recv_counts_,
+        target_data_recv_displacements_ );
+#ifdef TIMER_DETAILED
+      sw_communicate_target_data_.stop();
+#endif
+    } // of omp single; implicit barrier
+
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      const int begin = target_data_recv_displacements_[ rank ];
+      const int end = begin + target_data_recv_counts_[ rank ];
+      for ( int i = begin; i < end; ++i )
+      {
+        if ( recv_buffer_target_data_[ i ].get_source_tid() == tid )
+        {
+          kernel().connection_manager.add_target( tid, rank, recv_buffer_target_data_[ i ] );
+        }
+      }
+    }
+#pragma omp barrier
+  } while ( has_more_target_data_ );
+
+  kernel().connection_manager.clear_source_table( tid );
+}
+
+void
+EventDeliveryManager::collocate_counted_target_data_( const thread tid, const AssignedRanks& assigned_ranks )
+{
+  if ( assigned_ranks.begin == assigned_ranks.end )
+  {
+    kernel().connection_manager.no_targets_to_process( tid );
+    return;
+  }
+
+  thread num_filled_ranks = 0;
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    target_data_send_positions_[ rank ] = target_data_send_displacements_[ rank ];
+    if ( target_data_send_counts_[ rank ] == 0 )
+    {
+      ++num_filled_ranks;
+    }
+  }
+
+  thread source_rank;
+  TargetData next_target_data;
+  while ( kernel().connection_manager.get_next_target_data(
+    tid, assigned_ranks.begin, assigned_ranks.end, source_rank, next_target_data ) )
   {
-    it->resize( kernel().connection_manager.get_min_delay(), std::vector< Target >() );
+    const size_t end = target_data_send_displacements_[ source_rank ] + target_data_send_counts_[ source_rank ];
+    if ( target_data_send_positions_[ source_rank ] == end )
+    {
+      // the chunk of this rank is full in this round, the entry is sent
+      // in one of the next rounds, which start from the first rejected
+      // entry
+      kernel().connection_manager.reject_last_target_data( tid );
+      kernel().connection_manager.save_source_table_entry_point( tid );
+      if ( num_filled_ranks == assigned_ranks.size )
+      {
+        break;
+      }
+      continue;
+    }
+
+    send_buffer_target_data_[ target_data_send_positions_[ source_rank ]++ ] = next_target_data;
+    if ( target_data_send_positions_[ source_rank ] == end )
+    {
+      ++num_filled_ranks;
+    }
   }
 
-  for (
-    std::vector< std::vector< std::vector< OffGridTarget > > >::iterator it = off_grid_spike_register_[ tid ].begin();
-    it != off_grid_spike_register_[ tid ].end();
-    ++it )
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
   {
-    it->resize( kernel().connection_manager.get_min_delay(), std::vector< OffGridTarget >() );
+    // the counts are exact, so every chunk is filled
+    assert( target_data_send_positions_[ rank ]
+      == static_cast< size_t >( target_data_send_displacements_[ rank ] + target_data_send_counts_[ rank ] ) );
   }
 }
 
+void
+EventDeliveryManager::resize_spike_register_( const thread tid )
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
+  off_grid_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
+  pending_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
+  pending_off_grid_spike_register_[ tid ].resize( num_threads, kernel().connection_manager.get_min_delay() );
+}
+
 } // of namespace nest
@@ -29,10 +29,12 @@
 #include <vector>
 
 // Includes from libnestutil:
+#include "config.h"
 #include "manager_interface.h"
 #include "stopwatch.h"
 
 // Includes from nestkernel:
+#include "connector_model.h"
 #include "event.h"
 #include "spikeevent3.h"
 #include "mpi_manager.h" // OffGridSpike
@@ -40,6 +42,7 @@
 #include "nest_types.h"
 #include "node.h"
 #include "per_thread_bool_indicator.h"
+#include "spike_register.h"
 #include "target_table.h"
 #include "spike_data.h"
 #include "vp_manager.h"
@@ -61,12 +64,13 @@ public:
   virtual ~EventDeliveryManager();
 
   virtual void initialize();
-  void map_1();
   virtual void finalize();
 
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  virtual void prepare();
+
   /**
    * Standard routine for sending events. This method decides if
    * the event has to be delivered locally or globally. It exists
@@ -199,9 +203,24 @@ public:
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * With pipelined spike exchange, first delivers the spikes of the
+   * previous slice and then only starts the communication of the
+   * spikes of this slice, which proceeds during the update of the
+   * next slice.
    */
   void gather_spike_data( const thread tid );
 
+  /**
+   * Waits for spikes still in flight from the pipelined spike exchange
+   * and delivers them. Does nothing if no spikes are pending.
+   */
+  void complete_pending_spike_data( const thread tid );
+
+  bool get_pipelined_spike_exchange() const;
+
+  bool get_encode_spike_data() const;
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -254,8 +273,114 @@ private:
     std::vector< SpikeDataT >& send_buffer,
     std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Gathers spikes with the alltoallv protocol: counts the spikes for
+   * each rank, exchanges the counts and then sends exactly sized chunks
+   * in a single round, without markers.
+   */
+  template < typename SpikeDataT >
+  void gather_counted_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Adds the number of spikes that reading thread tid sends to each
+   * rank to spike_data_send_counts_.
+   */
+  template < typename TargetT >
+  void count_spike_data_( const thread tid, std::vector< SpikeRegister< TargetT > >& spike_register );
+
+  /**
+   * Writes the spikes that reading thread tid sends to their positions
+   * given by spike_data_send_positions_.
+   */
+  template < typename TargetT, typename SpikeDataT >
+  void write_spike_data_( const thread tid,
+    std::vector< SpikeRegister< TargetT > >& spike_register,
+    std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Encodes the chunks in the send buffer, exchanges the encoded chunks
+   * and decodes them to the receive buffer, setting the receive counts
+   * and displacements of the alltoallv protocol.
+   * @see spike_data_encoding.h
+   */
+  template < typename SpikeDataT >
+  void communicate_encoded_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Returns the range of the entries received from rank in the spike
+   * receive buffer. With markers, the valid entries may end earlier.
+   */
+  void get_spike_data_chunk_( const thread rank, size_t& begin, size_t& end ) const;
+
+  /**
+   * Moves the spikes of this slice to the pending registers and starts
+   * their exchange in a first gather round.
+   */
+  template < typename SpikeDataT >
+  void start_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Waits for the exchange started by start_spike_data_(), delivers the
+   * received spikes and performs further rounds if not all spikes fit
+   * into the MPI buffers.
+   */
+  template < typename SpikeDataT >
+  void complete_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Moves spikes from the given registers to the send buffer and sets
+   * the markers. First part of a gather round.
+   */
+  template < typename SpikeDataT >
+  void collocate_spike_data_round_( const thread tid,
+    std::vector< SpikeRegister< Target > >& spike_register,
+    std::vector< SpikeRegister< OffGridTarget > >& off_grid_spike_register,
+    std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Exchanges the spike data buffers. Must be called by a single thread.
+   */
+  template < typename SpikeDataT >
+  void communicate_spike_data_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    const bool nonblocking );
+
+  /**
+   * Exchanges the spike data buffers in a blocking round. With
+   * thread_parallel_spike_exchange, each thread sends and receives the
+   * chunks of its assigned ranks, otherwise a single thread exchanges
+   * all chunks. Must be called by all threads.
+   */
+  template < typename SpikeDataT >
+  void exchange_spike_data_round_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Delivers received spikes, determines whether another gather round
+   * is needed and grows the MPI buffers if so. Last part of a gather
+   * round.
+   */
+  template < typename SpikeDataT >
+  void deliver_spike_data_round_( const thread tid, const std::vector< SpikeDataT >& recv_buffer, const bool deferred );
+
   void resize_send_recv_buffers_spike_data_();
 
+  /**
+   * Adapts the size of the MPI buffer for spikes at the end of a time
+   * slice, either to the spike counts of recent slices or by shrinking
+   * it after a slice without overflow. Called by a single thread.
+   */
+  void update_buffer_size_spike_data_();
+
   /**
    * Moves spikes from on grid and off grid spike registers to correct
    * locations in MPI buffers.
@@ -264,7 +389,7 @@ private:
   bool collocate_spike_data_buffers_( const thread tid,
     const AssignedRanks& assigned_ranks,
     SendBufferPosition& send_buffer_position,
-    std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register,
+    std::vector< SpikeRegister< TargetT > >& spike_register,
     std::vector< SpikeDataT >& send_buffer );
 
   /**
@@ -295,10 +420,54 @@ private:
 
   /**
    * Reads spikes from MPI buffers and delivers them to ringbuffer of
-   * nodes.
+   * nodes. Deferred spikes were emitted in the previous slice.
+   */
+  template < typename SpikeDataT >
+  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer, const bool deferred );
+
+  /**
+   * Groups the valid entries of the receive buffer by target thread and
+   * synapse type with a counting sort, such that in deliver_events_
+   * each thread only visits its own entries instead of scanning the
+   * entire buffer. Must be called by a single thread after
+   * communication.
+   */
+  template < typename SpikeDataT >
+  void sort_spike_data_( const std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Hands the spikes collected by deliver_events_ in batched mode to
+   * their receivers. Spikes are grouped by target node with a stable
+   * counting sort, such that every node receives its spikes in the same
+   * order as with immediate delivery, and the next receivers are
+   * prefetched while the current one handles its spikes.
+   */
+  void deliver_batched_spike_events_( const thread tid );
+
+#ifdef HAVE_OFFLOAD
+  /**
+   * Delivers the spikes of synapse type syn_id, given as positions in
+   * the receive buffer ordered by lcid, from the connectivity snapshot.
+   * The targets of all spikes are resolved and gathered in OpenMP
+   * target regions, afterwards the events are handed to the receivers
+   * on the host in the same order as by deliver_events_.
    */
   template < typename SpikeDataT >
-  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+  void deliver_offloaded_spikes_( const thread tid,
+    const synindex syn_id,
+    const std::vector< size_t >::const_iterator begin,
+    const std::vector< size_t >::const_iterator end,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const std::vector< Time >& prepared_timestamps,
+    SpikeEvent& se );
+#endif
+
+  /**
+   * Number of collected spikes after which deliver_events_ hands them
+   * to their receivers in batched mode. Bounds the batch to a size that
+   * stays in cache.
+   */
+  static const size_t batched_spike_events_chunk_size_ = 4096;
 
   /**
    * Deletes all spikes from spike registers and resets spike
@@ -313,11 +482,11 @@ private:
   void resize_spike_register_( const thread tid );
 
   /**
-   * Returns true if spike has been moved to MPI buffer, such that it
-   * can be removed by clean_spike_register. Required static function
-   * by std::remove_if.
+   * Groups the spikes in the spike registers of thread tid by reading
+   * thread and lag. Must be called before spikes are moved to MPI
+   * buffers.
    */
-  static bool is_marked_for_removal_( const Target& target );
+  void freeze_spike_register_( const thread tid );
 
   /**
    * Removes spikes that were successfully moved to MPI buffers from
@@ -349,6 +518,21 @@ private:
    */
   bool distribute_target_data_buffers_( const thread tid );
 
+  /**
+   * Exchanges connection information in exactly sized rounds: counts
+   * the target data for each rank from the SourceTable, then sends at
+   * most target_data_chunk_size_ entries per rank and round via
+   * MPI_Alltoallv, without markers and buffer growth.
+   */
+  void gather_counted_target_data_( const thread tid );
+
+  /**
+   * Writes the target data that thread tid sends to its assigned ranks
+   * in this round to their positions given by
+   * target_data_send_positions_.
+   */
+  void collocate_counted_target_data_( const thread tid, const AssignedRanks& assigned_ranks );
+
   /**
    * Sends event e to all targets of node source. Delivers events from
    * devices directly to targets.
@@ -362,6 +546,26 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  bool batched_spike_delivery_; //!< indicates whether spikes are delivered
+                                //!< grouped by target node
+
+  bool offload_spike_delivery_; //!< indicates whether targets of spikes are
+                                //!< resolved in OpenMP target regions
+
+  bool pipelined_spike_exchange_; //!< indicates whether the exchange of spikes
+                                  //!< overlaps with the update of the next slice
+
+  bool has_pending_spike_data_; //!< indicates whether spikes are in flight
+
+  bool encode_spike_data_; //!< indicates whether spikes are sent in the
+                           //!< compact encoding of spike_data_encoding.h
+
+  bool counted_target_data_; //!< indicates whether connection information
+                             //!< is counted before it is exchanged
+
+  size_t target_data_chunk_size_; //!< maximal number of target data sent to
+                                  //!< each rank per round, 0 for no limit
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -385,28 +589,55 @@ private:
   std::vector< delay > slice_moduli_;
 
   /**
-   * Register for node IDs of neurons that spiked. This is a 4-dim
-   * structure. While spikes are written to the buffer they are
-   * immediately sorted by the thread that will later move the spikes to the
-   * MPI buffers.
-   * - First dim: write threads (from node to register)
-   * - Second dim: read threads (from register to MPI buffer)
-   * - Third dim: lag
-   * - Fourth dim: Target (will be converted in SpikeData)
+   * Register for node IDs of neurons that spiked, one per writing
+   * thread (from node to register). Within each register, spikes are
+   * grouped by the reading thread that will later move them to the
+   * MPI buffers and by lag.
    */
-  std::vector< std::vector< std::vector< std::vector< Target > > > > spike_register_;
+  std::vector< SpikeRegister< Target > > spike_register_;
 
   /**
-   * Register for node IDs of precise neurons that spiked. This is a 4-dim
-   * structure. While spikes are written to the buffer they are
-   * immediately sorted by the thread that will later move the spikes to the
-   * MPI buffers.
-   * - First dim: write threads (from node to register)
-   * - Second dim: read threads (from register to MPI buffer)
-   * - Third dim: lag
-   * - Fourth dim: OffGridTarget (will be converted in OffGridSpikeData)
+   * Register for node IDs of precise neurons that spiked, one per
+   * writing thread. Organized as spike_register_, but holds
+   * OffGridTarget (will be converted in OffGridSpikeData).
    */
-  std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > > off_grid_spike_register_;
+  std::vector< SpikeRegister< OffGridTarget > > off_grid_spike_register_;
+
+  /**
+   * Registers of the spikes of the previous slice, which are in flight
+   * with pipelined spike exchange. Swapped with spike_register_ and
+   * off_grid_spike_register_ at the end of each slice.
+   */
+  std::vector< SpikeRegister< Target > > pending_spike_register_;
+  std::vector< SpikeRegister< OffGridTarget > > pending_off_grid_spike_register_;
+
+  //! Number of spike data entries sent to and received from each rank,
+  //! and their positions in the buffers, with the alltoallv protocol
+  std::vector< int > spike_data_send_counts_;
+  std::vector< int > spike_data_send_displacements_;
+  std::vector< size_t > spike_data_send_positions_; //!< write position per rank
+  std::vector< int > spike_data_recv_counts_;
+  std::vector< int > spike_data_recv_displacements_;
+
+  //! Encoded chunks and their sizes and positions (in ints) with
+  //! encode_spike_data_
+  std::vector< unsigned int > send_buffer_encoded_spike_data_;
+  std::vector< unsigned int > recv_buffer_encoded_spike_data_;
+  std::vector< int > encoded_spike_data_send_counts_;
+  std::vector< int > encoded_spike_data_send_displacements_;
+  std::vector< int > encoded_spike_data_recv_counts_;
+  std::vector< int > encoded_spike_data_recv_displacements_;
+
+  //! Number of target data not yet sent to each rank, and number and
+  //! positions of target data in the current round, with
+  //! counted_target_data_
+  std::vector< size_t > target_data_remaining_counts_;
+  std::vector< int > target_data_send_counts_;
+  std::vector< int > target_data_send_displacements_;
+  std::vector< size_t > target_data_send_positions_;
+  std::vector< int > target_data_recv_counts_;
+  std::vector< int > target_data_recv_displacements_;
+  bool has_more_target_data_; //!< whether another round is needed
 
   /**
    * Buffer to collect the secondary events
@@ -428,6 +659,62 @@ private:
 
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
+
+  /**
+   * Positions of the valid entries in the spike receive buffer, ordered
+   * by target thread, syn_id and lcid. Filled by sort_spike_data_.
+   */
+  std::vector< size_t > sorted_spike_data_;
+
+  /**
+   * Start of the entries for thread tid and synapse type syn_id in
+   * sorted_spike_data_ at index tid * num_syn_ids + syn_id. Holds one
+   * additional element marking the end of the last range.
+   */
+  std::vector< size_t > sorted_spike_data_begin_;
+
+  /**
+   * Table of spike delivery functions indexed by syn_id. Rebuilt in
+   * prepare() from the synapse prototypes, such that every synapse model
+   * delivers spikes without a virtual call per spike.
+   */
+  std::vector< SpikeDeliveryFunction > spike_delivery_functions_;
+
+  /**
+   * Spikes collected per thread in batched delivery mode, in the order
+   * in which synapses emitted them.
+   */
+  std::vector< std::vector< BufferedSpike > > batched_spike_events_;
+
+  /**
+   * Per thread, start of the events of each thread-local node in
+   * batched_spike_events_order_.
+   */
+  std::vector< std::vector< size_t > > batched_spike_events_begin_;
+
+  /**
+   * Per thread, positions of the collected spike events grouped by
+   * thread-local id of their receiver.
+   */
+  std::vector< std::vector< size_t > > batched_spike_events_order_;
+
+#ifdef HAVE_OFFLOAD
+  /**
+   * Per-thread work arrays of offloaded spike delivery.
+   */
+  struct OffloadedSpikes
+  {
+    std::vector< index > lcids_;  //!< first connection of each spike
+    std::vector< size_t > begin_; //!< start of the targets of each spike
+    std::vector< index > targets_;
+    std::vector< rport > rports_;
+    std::vector< double > weights_;
+    std::vector< delay > delays_;
+  };
+
+  std::vector< OffloadedSpikes > offloaded_spikes_;
+#endif
+
   //!< whether size of MPI buffer for communication of connections was changed
   bool buffer_size_target_data_has_changed_;
   //!< whether size of MPI buffer for communication of spikes was changed
@@ -435,6 +722,14 @@ private:
   //!< whether size of MPI buffer for communication of spikes can be decreased
   bool decrease_buffer_size_spike_data_;
 
+  //! Number of spikes sent to each rank in the current time slice,
+  //! recorded if the MPI buffer size is predicted from spike counts
+  std::vector< size_t > slice_spike_data_counts_;
+
+  //! Number of additional spike gather rounds during the last call to
+  //! simulate
+  unsigned long spike_buffer_overflow_rounds_;
+
   PerThreadBoolIndicator gather_completed_checker_;
 
 #ifdef TIMER_DETAILED
@@ -450,59 +745,24 @@ private:
 inline void
 EventDeliveryManager::reset_spike_register_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
-        it < spike_register_[ tid ].end();
-        ++it )
-  {
-    for ( std::vector< std::vector< Target > >::iterator iit = it->begin(); iit < it->end(); ++iit )
-    {
-      ( *iit ).clear();
-    }
-  }
-
-  for (
-    std::vector< std::vector< std::vector< OffGridTarget > > >::iterator it = off_grid_spike_register_[ tid ].begin();
-    it < off_grid_spike_register_[ tid ].end();
-    ++it )
-  {
-    for ( std::vector< std::vector< OffGridTarget > >::iterator iit = it->begin(); iit < it->end(); ++iit )
-    {
-      iit->clear();
-    }
-  }
+  spike_register_[ tid ].clear();
+  off_grid_spike_register_[ tid ].clear();
+  pending_spike_register_[ tid ].clear();
+  pending_off_grid_spike_register_[ tid ].clear();
 }
 
-inline bool
-EventDeliveryManager::is_marked_for_removal_( const Target& target )
+inline void
+EventDeliveryManager::freeze_spike_register_( const thread tid )
 {
-  return target.is_processed();
+  spike_register_[ tid ].freeze();
+  off_grid_spike_register_[ tid ].freeze();
 }
 
 inline void
 EventDeliveryManager::clean_spike_register_( const thread tid )
 {
-  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
-        it < spike_register_[ tid ].end();
-        ++it )
-  {
-    for ( std::vector< std::vector< Target > >::iterator iit = it->begin(); iit < it->end(); ++iit )
-    {
-      std::vector< Target >::iterator new_end = std::remove_if( iit->begin(), iit->end(), is_marked_for_removal_ );
-      iit->erase( new_end, iit->end() );
-    }
-  }
-  for (
-    std::vector< std::vector< std::vector< OffGridTarget > > >::iterator it = off_grid_spike_register_[ tid ].begin();
-    it < off_grid_spike_register_[ tid ].end();
-    ++it )
-  {
-    for ( std::vector< std::vector< OffGridTarget > >::iterator iit = it->begin(); iit < it->end(); ++iit )
-    {
-      std::vector< OffGridTarget >::iterator new_end =
-        std::remove_if( iit->begin(), iit->end(), is_marked_for_removal_ );
-      iit->erase( new_end, iit->end() );
-    }
-  }
+  spike_register_[ tid ].clean();
+  off_grid_spike_register_[ tid ].clean();
 }
 
 inline void
@@ -511,6 +771,18 @@ EventDeliveryManager::send_to_node( Event& e )
   e();
 }
 
+inline bool
+EventDeliveryManager::get_pipelined_spike_exchange() const
+{
+  return pipelined_spike_exchange_;
+}
+
+inline bool
+EventDeliveryManager::get_encode_spike_data() const
+{
+  return encode_spike_data_;
+}
+
 inline bool
 EventDeliveryManager::get_off_grid_communication() const
 {
@@ -116,7 +116,7 @@ EventDeliveryManager::send_remote( thread tid, SpikeEvent& e, const long lag )
     // Unroll spike multiplicity as plastic synapses only handle individual spikes.
     for ( int i = 0; i < e.get_multiplicity(); ++i )
     {
-      spike_register_[ tid ][ assigned_tid ][ lag ].push_back( *it );
+      spike_register_[ tid ].push_back( assigned_tid, lag, *it );
     }
   }
 }
@@ -136,7 +136,7 @@ EventDeliveryManager::send_off_grid_remote( thread tid, EventT& e, const long la
     // Unroll spike multiplicity as plastic synapses only handle individual spikes.
     for ( int i = 0; i < e.get_multiplicity(); ++i )
     {
-      off_grid_spike_register_[ tid ][ assigned_tid ][ lag ].push_back( OffGridTarget( *it, e.get_offset() ) );
+      off_grid_spike_register_[ tid ].push_back( assigned_tid, lag, OffGridTarget( *it, e.get_offset() ) );
     }
   }
 }
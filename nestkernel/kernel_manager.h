@@ -69,6 +69,53 @@
  num_processes                 integertype - The number of MPI processes (read only)
  off_grid_spiking              booltype    - Whether to transmit precise spike times in MPI
                                              communication (read only)
+ batched_spike_delivery        booltype    - Whether to collect all incoming spikes of a time slice
+                                             and deliver them grouped by target node
+ offload_spike_delivery        booltype    - Whether to resolve the targets of incoming spikes in
+                                             OpenMP target regions (requires -Dwith-offload=ON)
+ spike_exchange                stringtype  - Protocol for the exchange of spikes between MPI processes:
+                                             "alltoall" (default), "sparse", which only communicates
+                                             with processes that host targets or sources of local neurons,
+                                             "alltoallv", which first exchanges the number of spikes
+                                             per process and then sends exactly sized buffers, or
+                                             "hierarchical", which shares spikes through shared memory
+                                             within a node and communicates between nodes only from
+                                             the lowest process of each node
+ ranks_per_node                integertype - Number of consecutive processes that form a node in the
+                                             hierarchical spike exchange; 0 (default) groups all
+                                             processes that share memory
+ persistent_mpi_requests       booltype    - Whether to exchange spikes with spike_exchange "alltoall"
+                                             and secondary events through persistent MPI requests,
+                                             which are created once per buffer size and restarted
+                                             in every time slice
+ thread_parallel_spike_exchange booltype   - Whether each thread exchanges the spikes of its assigned
+                                             processes with spike_exchange "alltoall", which requires
+                                             MPI to provide MPI_THREAD_MULTIPLE
+ pipelined_spike_exchange      booltype    - Whether to exchange the spikes of a time slice during the
+                                             update of the next one; requires all delays to be at
+                                             least twice min_delay
+ encode_spike_data             booltype    - Whether to send spikes in a compact encoding with shared
+                                             headers of thread, synapse type and lag and
+                                             delta-encoded connection indices; requires
+                                             spike_exchange "alltoallv"
+ counted_target_data           booltype    - Whether to count the connection information for each
+                                             process before exchanging it in exactly sized rounds,
+                                             instead of growing buffers until everything fits
+ target_data_chunk_size        integertype - Maximal number of connection entries sent to each process
+                                             per round of the counted exchange; 0 (default) sends
+                                             everything in a single round
+ spike_buffer_quantile         doubletype  - Quantile of the largest number of spikes sent to a single
+                                             process in recent time slices, to which the spike buffers
+                                             are sized with adaptive_spike_buffers; 0 (default) shrinks
+                                             them by shrink_factor_buffer_spike_data instead
+ spike_buffer_history_length   integertype - Number of recent time slices for spike_buffer_quantile;
+                                             the buffers are sized after this many slices and after
+                                             each slice that needed more than one round (default 100)
+ spike_buffer_overflow_rounds  integertype - Number of additional rounds of spike exchange because the
+                                             spike buffers were full during the last call to Simulate
+                                             (read only)
+ spike_buffer_memory           integertype - Memory of the spike buffers of this process in bytes
+                                             (read only)
 
  Connector configuration
  initial_connector_capacity    integertype - When a connector is first created, it starts with this
@@ -94,6 +141,13 @@
  num_connections               integertype - The number of connections in the network
                                              (read only, local only)
 
+ Node update
+ population_update             booltype    - Whether to update consecutive neurons of models that
+                                             support it (iaf_psc_alpha, iaf_psc_exp, iaf_psc_delta,
+                                             and aeif_cond_alpha and iaf_cond_exp if their
+                                             batched_solver is set) together, with their state in
+                                             contiguous arrays
+
  Waveform relaxation method (wfr)
  use_wfr                       booltype    - Whether to use waveform relaxation method
  wfr_comm_interval             doubletype  - Desired waveform relaxation communication interval
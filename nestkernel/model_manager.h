@@ -184,6 +184,34 @@ public:
   void register_secondary_connection_model( const std::string& name,
     const RegisterConnectionModelFlags flags = default_secondary_connection_model_flags );
 
+  /**
+   * Register a synapse model whose connections are stored as structure of
+   * arrays in a SoAConnector instead of as array of ConnectionT objects.
+   *
+   * Only static synapse types that define SoAWeightsType can be
+   * registered this way. The "hpc" version is registered as for
+   * register_connection_model(); a labeled version is not available, as
+   * SoAConnector does not store labels.
+   *
+   * @param name The name under which the ConnectorModel will be registered.
+   */
+  template < template < typename targetidentifierT > class ConnectionT >
+  void register_soa_connection_model( const std::string& name,
+    const RegisterConnectionModelFlags flags = default_soa_connection_model_flags );
+
+  /**
+   * Deliver spikes through the synapse model with the given name, and
+   * through its "hpc" and "compact" versions if registered, to targets of type TargetT
+   * without dynamic dispatch of Node::handle(). Spikes to targets of
+   * other types are delivered as before. Only one target type can be
+   * registered per synapse model.
+   *
+   * @param name The name under which the ConnectorModel has been
+   * registered with register_connection_model().
+   */
+  template < template < typename targetidentifierT > class ConnectionT, class TargetT >
+  void register_spike_delivery_target( const std::string& name );
+
   /**
    * @return The model id of a given model name
    */
@@ -280,6 +308,9 @@ private:
 
   synindex register_connection_model_( ConnectorModel* );
 
+  template < typename ConnectionT, class TargetT >
+  void set_spike_delivery_target_( const std::string& name );
+
   /**
    * Copy an existing node model and register it as a new model.
    * @param old_id ID of existing model.
@@ -362,6 +393,8 @@ private:
    'synapsedict info' shows the contents of the dictionary
    Synapse model names ending with '_hpc' provide minimal memory requirements by
    using thread-local target neuron IDs and fixing the `rport` to 0.
+   Synapse model names ending with '_compact' use thread-local target neuron
+   IDs as well, but support `rport` values up to 255.
    Synapse model names ending with '_lbl' allow to assign an individual integer
    label (`synapse_label`) to created synapses at the cost of increased memory
    requirements.
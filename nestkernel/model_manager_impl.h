@@ -31,6 +31,7 @@
 
 // Includes from nestkernel:
 #include "connection_label.h"
+#include "connector_soa.h"
 #include "kernel_manager.h"
 #include "nest.h"
 #include "target_identifier.h"
@@ -109,6 +110,20 @@ ModelManager::register_connection_model( const std::string& name, const Register
     register_connection_model_( cf );
   }
 
+  // register the "compact" version with the same parameters but a target
+  // identifier that stores thread-local index and rport in 32 bits
+  if ( enumFlagSet( flags, RegisterConnectionModelFlags::REGISTER_COMPACT ) )
+  {
+    cf = new GenericConnectorModel< ConnectionT< TargetIdentifierIndex32 > >( name + "_compact",
+      enumFlagSet( flags, RegisterConnectionModelFlags::IS_PRIMARY ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::HAS_DELAY ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_SYMMETRIC ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::SUPPORTS_WFR ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_CLOPATH_ARCHIVING ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_URBANCZIK_ARCHIVING ) );
+    register_connection_model_( cf );
+  }
+
   // register the "lbl" (labeled) version with the same parameters but a
   // different connection type
   if ( enumFlagSet( flags, RegisterConnectionModelFlags::REGISTER_LBL ) )
@@ -124,6 +139,79 @@ ModelManager::register_connection_model( const std::string& name, const Register
   }
 }
 
+template < template < typename targetidentifierT > class ConnectionT >
+void
+ModelManager::register_soa_connection_model( const std::string& name, const RegisterConnectionModelFlags flags )
+{
+  assert( not enumFlagSet( flags, RegisterConnectionModelFlags::REGISTER_LBL ) );
+  assert( not enumFlagSet( flags, RegisterConnectionModelFlags::REGISTER_COMPACT ) );
+
+  ConnectorModel* cf = new GenericConnectorModel< ConnectionT< TargetIdentifierPtrRport >,
+    SoAConnector< ConnectionT< TargetIdentifierPtrRport > > >( name,
+    enumFlagSet( flags, RegisterConnectionModelFlags::IS_PRIMARY ),
+    enumFlagSet( flags, RegisterConnectionModelFlags::HAS_DELAY ),
+    enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_SYMMETRIC ),
+    enumFlagSet( flags, RegisterConnectionModelFlags::SUPPORTS_WFR ),
+    enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_CLOPATH_ARCHIVING ),
+    enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_URBANCZIK_ARCHIVING ) );
+  register_connection_model_( cf );
+
+  if ( enumFlagSet( flags, RegisterConnectionModelFlags::REGISTER_HPC ) )
+  {
+    cf = new GenericConnectorModel< ConnectionT< TargetIdentifierIndex >,
+      SoAConnector< ConnectionT< TargetIdentifierIndex > > >( name + "_hpc",
+      enumFlagSet( flags, RegisterConnectionModelFlags::IS_PRIMARY ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::HAS_DELAY ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_SYMMETRIC ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::SUPPORTS_WFR ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_CLOPATH_ARCHIVING ),
+      enumFlagSet( flags, RegisterConnectionModelFlags::REQUIRES_URBANCZIK_ARCHIVING ) );
+    register_connection_model_( cf );
+  }
+}
+
+template < template < typename targetidentifierT > class ConnectionT, class TargetT >
+void
+ModelManager::register_spike_delivery_target( const std::string& name )
+{
+  set_spike_delivery_target_< ConnectionT< TargetIdentifierPtrRport >, TargetT >( name );
+
+  if ( synapsedict_->known( name + "_hpc" ) )
+  {
+    set_spike_delivery_target_< ConnectionT< TargetIdentifierIndex >, TargetT >( name + "_hpc" );
+  }
+
+  if ( synapsedict_->known( name + "_compact" ) )
+  {
+    set_spike_delivery_target_< ConnectionT< TargetIdentifierIndex32 >, TargetT >( name + "_compact" );
+  }
+}
+
+template < typename ConnectionT, class TargetT >
+void
+ModelManager::set_spike_delivery_target_( const std::string& name )
+{
+  const Token synmodel = synapsedict_->lookup( name );
+  if ( synmodel.empty() )
+  {
+    throw UnknownSynapseType( name );
+  }
+  const synindex syn_id = static_cast< index >( synmodel );
+
+  // only models storing their connections in Connector< ConnectionT >
+  // provide typed spike delivery
+  GenericConnectorModel< ConnectionT >* cm =
+    dynamic_cast< GenericConnectorModel< ConnectionT >* >( pristine_prototypes_[ syn_id ] );
+  assert( cm != 0 );
+  cm->template set_spike_delivery_target< TargetT >();
+
+  for ( thread t = 0; t < static_cast< thread >( kernel().vp_manager.get_num_threads() ); ++t )
+  {
+    static_cast< GenericConnectorModel< ConnectionT >* >( prototypes_[ t ][ syn_id ] )
+      ->template set_spike_delivery_target< TargetT >();
+  }
+}
+
 /**
  * Register a synape with default Connector and without any common properties.
  */
@@ -23,6 +23,8 @@
 #include "mpi_manager.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <numeric>
 
@@ -69,13 +71,36 @@ nest::MPIManager::MPIManager()
   , growth_factor_buffer_spike_data_( 1.5 )
   , growth_factor_buffer_target_data_( 1.5 )
   , shrink_factor_buffer_spike_data_( 1.1 )
+  , spike_buffer_quantile_( 0. )
+  , spike_buffer_history_length_( 100 )
+  , spike_count_history_pos_( 0 )
+  , spike_count_history_size_( 0 )
+  , slices_since_spike_buffer_update_( 0 )
   , send_recv_count_spike_data_per_rank_( 0 )
   , send_recv_count_target_data_per_rank_( 0 )
+  , spike_exchange_( SPIKE_EXCHANGE_ALLTOALL )
+  , ranks_per_node_( 0 )
+  , persistent_mpi_requests_( false )
+  , thread_parallel_spike_exchange_( false )
+  , mpi_thread_multiple_( false )
 #ifdef HAVE_MPI
   , comm_step_( std::vector< int >() )
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , spike_neighbour_comm_( MPI_COMM_NULL )
+  , spike_thread_comm_( MPI_COMM_NULL )
+  , spike_data_request_( MPI_REQUEST_NULL )
+  , spike_data_exchange_( 1 )
+  , secondary_events_exchange_( 2 )
+  , spike_node_comm_( MPI_COMM_NULL )
+  , spike_leader_comm_( MPI_COMM_NULL )
+  , spike_node_( 0 )
+  , spike_node_rank_( 0 )
+  , spike_send_win_( MPI_WIN_NULL )
+  , spike_recv_win_( MPI_WIN_NULL )
+  , spike_recv_segment_( 0 )
+  , spike_win_count_( 0 )
 #endif
 {
 }
@@ -113,6 +138,8 @@ nest::MPIManager::set_communicator( MPI_Comm global_comm )
   // last entry to communicate end of communication)
   kernel().mpi_manager.set_buffer_size_target_data( 2 * kernel().mpi_manager.get_num_processes() );
   kernel().mpi_manager.set_buffer_size_spike_data( 2 * kernel().mpi_manager.get_num_processes() );
+
+  reset_spike_exchange_ranks_();
 }
 
 void
@@ -128,8 +155,10 @@ nest::MPIManager::init_mpi( int* argc, char** argv[] )
     // get a communicator from MUSIC
     set_communicator( static_cast< MPI_Comm >( kernel().music_manager.communicator() ) );
 #else  /* #ifdef HAVE_MUSIC */
+    // MPI_THREAD_MULTIPLE allows the thread-parallel spike exchange;
+    // all other communication is serialized by omp single regions
     int provided_thread_level;
-    MPI_Init_thread( argc, argv, MPI_THREAD_FUNNELED, &provided_thread_level );
+    MPI_Init_thread( argc, argv, MPI_THREAD_MULTIPLE, &provided_thread_level );
     set_communicator( MPI_COMM_WORLD );
 #endif /* #ifdef HAVE_MUSIC */
   }
@@ -147,6 +176,10 @@ nest::MPIManager::init_mpi( int* argc, char** argv[] )
 #endif
   }
 
+  int thread_level;
+  MPI_Query_thread( &thread_level );
+  mpi_thread_multiple_ = thread_level == MPI_THREAD_MULTIPLE;
+
   recv_counts_secondary_events_in_int_per_rank_.resize( get_num_processes(), 0 );
   recv_displacements_secondary_events_in_int_per_rank_.resize( get_num_processes(), 0 );
   send_counts_secondary_events_in_int_per_rank_.resize( get_num_processes(), 0 );
@@ -185,11 +218,39 @@ nest::MPIManager::init_mpi( int* argc, char** argv[] )
 void
 nest::MPIManager::initialize()
 {
+  // Ensures that ResetKernel resets the spike exchange protocol
+  spike_exchange_ = SPIKE_EXCHANGE_ALLTOALL;
+  ranks_per_node_ = 0;
+  persistent_mpi_requests_ = false;
+  thread_parallel_spike_exchange_ = false;
+  spike_buffer_quantile_ = 0.;
+  spike_buffer_history_length_ = 100;
+  reset_spike_count_history_();
+#ifdef HAVE_MPI
+  free_spike_neighbour_comm_();
+  free_spike_thread_comm_();
+  free_spike_node_comms_();
+  free_persistent_exchange_( spike_data_exchange_ );
+  free_persistent_exchange_( secondary_events_exchange_ );
+  reset_spike_exchange_ranks_();
+
+  alltoallv_send_counts_in_int_.resize( get_num_processes() );
+  alltoallv_send_displacements_in_int_.resize( get_num_processes() );
+  alltoallv_recv_counts_in_int_.resize( get_num_processes() );
+  alltoallv_recv_displacements_in_int_.resize( get_num_processes() );
+#endif
 }
 
 void
 nest::MPIManager::finalize()
 {
+#ifdef HAVE_MPI
+  free_spike_neighbour_comm_();
+  free_spike_thread_comm_();
+  free_spike_node_comms_();
+  free_persistent_exchange_( spike_data_exchange_ );
+  free_persistent_exchange_( secondary_events_exchange_ );
+#endif
 }
 
 void
@@ -212,6 +273,7 @@ nest::MPIManager::set_status( const DictionaryDatum& dict )
     and new_buffer_size_spike_data < static_cast< long >( max_buffer_size_spike_data_ ) )
   {
     set_buffer_size_spike_data( new_buffer_size_spike_data );
+    reset_spike_count_history_();
   }
 
   updateValue< double >( dict, names::growth_factor_buffer_spike_data, growth_factor_buffer_spike_data_ );
@@ -221,6 +283,93 @@ nest::MPIManager::set_status( const DictionaryDatum& dict )
   updateValue< long >( dict, names::max_buffer_size_spike_data, max_buffer_size_spike_data_ );
 
   updateValue< double >( dict, names::shrink_factor_buffer_spike_data, shrink_factor_buffer_spike_data_ );
+
+  double spike_buffer_quantile = spike_buffer_quantile_;
+  if ( updateValue< double >( dict, names::spike_buffer_quantile, spike_buffer_quantile ) )
+  {
+    if ( spike_buffer_quantile < 0. or spike_buffer_quantile > 1. )
+    {
+      throw BadProperty( "spike_buffer_quantile must be in [0, 1]." );
+    }
+    spike_buffer_quantile_ = spike_buffer_quantile;
+  }
+
+  long spike_buffer_history_length = spike_buffer_history_length_;
+  if ( updateValue< long >( dict, names::spike_buffer_history_length, spike_buffer_history_length )
+    and spike_buffer_history_length != spike_buffer_history_length_ )
+  {
+    if ( spike_buffer_history_length < 1 )
+    {
+      throw BadProperty( "spike_buffer_history_length must be positive." );
+    }
+    spike_buffer_history_length_ = spike_buffer_history_length;
+    reset_spike_count_history_();
+  }
+
+  std::string spike_exchange;
+  if ( updateValue< std::string >( dict, names::spike_exchange, spike_exchange ) )
+  {
+    if ( spike_exchange == names::alltoall.toString() )
+    {
+      spike_exchange_ = SPIKE_EXCHANGE_ALLTOALL;
+    }
+    else if ( spike_exchange == names::sparse.toString() )
+    {
+      spike_exchange_ = SPIKE_EXCHANGE_SPARSE;
+    }
+    else if ( spike_exchange == names::alltoallv.toString() )
+    {
+      spike_exchange_ = SPIKE_EXCHANGE_ALLTOALLV;
+    }
+    else if ( spike_exchange == names::hierarchical.toString() )
+    {
+      spike_exchange_ = SPIKE_EXCHANGE_HIERARCHICAL;
+    }
+    else
+    {
+      throw BadProperty(
+        "spike_exchange must be \"alltoall\", \"sparse\", \"alltoallv\" or \"hierarchical\"." );
+    }
+  }
+
+  long ranks_per_node = ranks_per_node_;
+  if ( updateValue< long >( dict, names::ranks_per_node, ranks_per_node ) and ranks_per_node != ranks_per_node_ )
+  {
+    if ( ranks_per_node < 0 )
+    {
+      throw BadProperty( "ranks_per_node must be non-negative." );
+    }
+    ranks_per_node_ = ranks_per_node;
+#ifdef HAVE_MPI
+    // the nodes have changed, the communicators are recreated on the
+    // next hierarchical exchange
+    free_spike_node_comms_();
+#endif
+  }
+
+  bool persistent_mpi_requests = persistent_mpi_requests_;
+  if ( updateValue< bool >( dict, names::persistent_mpi_requests, persistent_mpi_requests )
+    and persistent_mpi_requests != persistent_mpi_requests_ )
+  {
+    persistent_mpi_requests_ = persistent_mpi_requests;
+#ifdef HAVE_MPI
+    free_persistent_exchange_( spike_data_exchange_ );
+    free_persistent_exchange_( secondary_events_exchange_ );
+#endif
+  }
+
+  bool thread_parallel_spike_exchange = thread_parallel_spike_exchange_;
+  if ( updateValue< bool >( dict, names::thread_parallel_spike_exchange, thread_parallel_spike_exchange ) )
+  {
+#ifdef HAVE_MPI
+    if ( thread_parallel_spike_exchange and not mpi_thread_multiple_ )
+    {
+      throw KernelException(
+        "thread_parallel_spike_exchange requires MPI_THREAD_MULTIPLE, which MPI does not provide." );
+    }
+#endif
+    thread_parallel_spike_exchange_ = thread_parallel_spike_exchange;
+  }
 }
 
 void
@@ -237,6 +386,109 @@ nest::MPIManager::get_status( DictionaryDatum& dict )
   def< size_t >( dict, names::max_buffer_size_target_data, max_buffer_size_target_data_ );
   def< double >( dict, names::growth_factor_buffer_spike_data, growth_factor_buffer_spike_data_ );
   def< double >( dict, names::growth_factor_buffer_target_data, growth_factor_buffer_target_data_ );
+  def< double >( dict, names::spike_buffer_quantile, spike_buffer_quantile_ );
+  def< long >( dict, names::spike_buffer_history_length, spike_buffer_history_length_ );
+  std::string spike_exchange = names::alltoall.toString();
+  if ( spike_exchange_ == SPIKE_EXCHANGE_SPARSE )
+  {
+    spike_exchange = names::sparse.toString();
+  }
+  else if ( spike_exchange_ == SPIKE_EXCHANGE_ALLTOALLV )
+  {
+    spike_exchange = names::alltoallv.toString();
+  }
+  else if ( spike_exchange_ == SPIKE_EXCHANGE_HIERARCHICAL )
+  {
+    spike_exchange = names::hierarchical.toString();
+  }
+  def< std::string >( dict, names::spike_exchange, spike_exchange );
+  def< long >( dict, names::ranks_per_node, ranks_per_node_ );
+  def< bool >( dict, names::persistent_mpi_requests, persistent_mpi_requests_ );
+  def< bool >( dict, names::thread_parallel_spike_exchange, thread_parallel_spike_exchange_ );
+}
+
+bool
+nest::MPIManager::update_buffer_size_spike_data( const size_t max_spike_count, const bool overflow )
+{
+  assert( predict_buffer_size_spike_data() );
+
+  spike_count_history_[ spike_count_history_pos_ ] = max_spike_count;
+  spike_count_history_pos_ = ( spike_count_history_pos_ + 1 ) % spike_count_history_.size();
+  spike_count_history_size_ = std::min( spike_count_history_size_ + 1, spike_count_history_.size() );
+  ++slices_since_spike_buffer_update_;
+
+  if ( not overflow and slices_since_spike_buffer_update_ < spike_count_history_.size() )
+  {
+    return false;
+  }
+  slices_since_spike_buffer_update_ = 0;
+
+  // Until the history is filled once, only the recorded entries at
+  // its beginning enter the quantile.
+  spike_count_quantile_buffer_.assign(
+    spike_count_history_.begin(), spike_count_history_.begin() + spike_count_history_size_ );
+  const size_t quantile_idx = std::max( std::ceil( spike_buffer_quantile_ * spike_count_history_size_ ), 1. ) - 1;
+  std::nth_element( spike_count_quantile_buffer_.begin(),
+    spike_count_quantile_buffer_.begin() + quantile_idx,
+    spike_count_quantile_buffer_.end() );
+
+  // All ranks need the same buffer size. A chunk needs at least two
+  // entries, such that the invalid marker of an empty chunk is not
+  // overwritten by the complete marker.
+  const size_t send_recv_count_per_rank =
+    std::max( static_cast< size_t >( max_cross_ranks( spike_count_quantile_buffer_[ quantile_idx ] ) ),
+      static_cast< size_t >( 2 ) );
+  const size_t buffer_size = std::min( send_recv_count_per_rank * get_num_processes(), max_buffer_size_spike_data_ );
+
+  if ( buffer_size == buffer_size_spike_data_ )
+  {
+    return false;
+  }
+  set_buffer_size_spike_data( buffer_size );
+  return true;
+}
+
+double
+nest::MPIManager::time_communicate_buffer( const Name& buffer_type,
+  const bool counted,
+  int num_entries,
+  int samples )
+{
+#ifdef HAVE_MPI
+  if ( buffer_type == names::spike_data )
+  {
+    return time_communicate_buffer_< SpikeData >( counted, num_entries, samples );
+  }
+  if ( buffer_type == names::off_grid_spike_data )
+  {
+    return time_communicate_buffer_< OffGridSpikeData >( counted, num_entries, samples );
+  }
+  if ( buffer_type == names::target_data )
+  {
+    return time_communicate_buffer_< TargetData >( counted, num_entries, samples );
+  }
+  if ( buffer_type == names::secondary_events )
+  {
+    // secondary events are exchanged in units of unsigned int
+    return time_communicate_buffer_< unsigned int >( counted, num_entries, samples );
+  }
+#else
+  if ( buffer_type == names::spike_data or buffer_type == names::off_grid_spike_data
+    or buffer_type == names::target_data or buffer_type == names::secondary_events )
+  {
+    return 0.0;
+  }
+#endif
+  throw BadProperty( "buffer_type must be /spike_data, /off_grid_spike_data, /target_data or /secondary_events." );
+}
+
+void
+nest::MPIManager::reset_spike_count_history_()
+{
+  spike_count_history_.assign( spike_buffer_history_length_, 0 );
+  spike_count_history_pos_ = 0;
+  spike_count_history_size_ = 0;
+  slices_since_spike_buffer_update_ = 0;
 }
 
 #ifdef HAVE_MPI
@@ -245,6 +497,11 @@ void
 nest::MPIManager::mpi_finalize( int exitcode )
 {
   MPI_Type_free( &MPI_OFFGRID_SPIKE );
+  free_spike_neighbour_comm_();
+  free_spike_thread_comm_();
+  free_spike_node_comms_();
+  free_persistent_exchange_( spike_data_exchange_ );
+  free_persistent_exchange_( secondary_events_exchange_ );
 
   int finalized;
   MPI_Finalized( &finalized );
@@ -801,19 +1058,574 @@ nest::MPIManager::any_true( const bool my_bool )
 
   // since there is no MPI_BOOL we first convert to int
   int my_int = my_bool;
+  int any_int = 0;
+  MPI_Allreduce( &my_int, &any_int, 1, MPI_INT, MPI_LOR, comm );
+
+  return any_int != 0;
+}
+
+void
+nest::MPIManager::reset_spike_exchange_ranks_()
+{
+  spike_target_ranks_.clear();
+  spike_source_ranks_.clear();
+  is_spike_source_rank_.assign( get_num_processes(), false );
+}
+
+void
+nest::MPIManager::free_spike_neighbour_comm_()
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+
+  if ( spike_neighbour_comm_ != MPI_COMM_NULL and finalized == 0 )
+  {
+    MPI_Comm_free( &spike_neighbour_comm_ );
+  }
+  spike_neighbour_comm_ = MPI_COMM_NULL;
+}
+
+void
+nest::MPIManager::free_spike_thread_comm_()
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+
+  if ( spike_thread_comm_ != MPI_COMM_NULL and finalized == 0 )
+  {
+    MPI_Comm_free( &spike_thread_comm_ );
+  }
+  spike_thread_comm_ = MPI_COMM_NULL;
+  spike_thread_requests_.clear();
+}
+
+void
+nest::MPIManager::prepare_thread_parallel_spike_exchange()
+{
+  if ( spike_thread_comm_ == MPI_COMM_NULL )
+  {
+    MPI_Comm_dup( comm, &spike_thread_comm_ );
+  }
+  spike_thread_requests_.resize( kernel().vp_manager.get_num_threads() );
+}
+
+void
+nest::MPIManager::set_spike_target_ranks( const std::vector< int >& is_target_rank )
+{
+  assert( is_target_rank.size() == static_cast< size_t >( get_num_processes() ) );
+
+  // this rank hosts targets of neurons on rank r if and only if rank r
+  // hosts sources of neurons on this rank
+  std::vector< int > is_source_rank( get_num_processes() );
+  MPI_Alltoall( &is_target_rank[ 0 ], 1, MPI_INT, &is_source_rank[ 0 ], 1, MPI_INT, comm );
+
+  // the neighbourhood has changed, the communicator is recreated on
+  // the next sparse exchange
+  free_spike_neighbour_comm_();
+  reset_spike_exchange_ranks_();
+
+  for ( thread rank = 0; rank < get_num_processes(); ++rank )
+  {
+    if ( rank == get_rank() )
+    {
+      continue;
+    }
+    if ( is_target_rank[ rank ] )
+    {
+      spike_target_ranks_.push_back( rank );
+    }
+    if ( is_source_rank[ rank ] )
+    {
+      spike_source_ranks_.push_back( rank );
+      is_spike_source_rank_[ rank ] = true;
+    }
+  }
+
+  spike_send_counts_.resize( spike_target_ranks_.size() );
+  spike_send_displacements_.resize( spike_target_ranks_.size() );
+  spike_recv_counts_.resize( spike_source_ranks_.size() );
+  spike_recv_displacements_.resize( spike_source_ranks_.size() );
+}
+
+void
+nest::MPIManager::communicate_Neighbor_alltoall_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count,
+  const bool nonblocking )
+{
+  if ( spike_neighbour_comm_ == MPI_COMM_NULL )
+  {
+    // all ranks get here in the same communication round, so the
+    // collective creation is safe
+    MPI_Dist_graph_create_adjacent( comm,
+      spike_source_ranks_.size(),
+      spike_source_ranks_.data(),
+      MPI_UNWEIGHTED,
+      spike_target_ranks_.size(),
+      spike_target_ranks_.data(),
+      MPI_UNWEIGHTED,
+      MPI_INFO_NULL,
+      0,
+      &spike_neighbour_comm_ );
+  }
+
+  for ( size_t i = 0; i < spike_target_ranks_.size(); ++i )
+  {
+    spike_send_counts_[ i ] = send_recv_count;
+    spike_send_displacements_[ i ] = spike_target_ranks_[ i ] * send_recv_count;
+  }
+  for ( size_t i = 0; i < spike_source_ranks_.size(); ++i )
+  {
+    spike_recv_counts_[ i ] = send_recv_count;
+    spike_recv_displacements_[ i ] = spike_source_ranks_[ i ] * send_recv_count;
+  }
+
+  // the count and displacement arrays are members, so they stay valid
+  // until a nonblocking exchange has completed
+  if ( nonblocking )
+  {
+    assert( spike_data_request_ == MPI_REQUEST_NULL );
+    MPI_Ineighbor_alltoallv( send_buffer,
+      spike_send_counts_.data(),
+      spike_send_displacements_.data(),
+      MPI_UNSIGNED,
+      recv_buffer,
+      spike_recv_counts_.data(),
+      spike_recv_displacements_.data(),
+      MPI_UNSIGNED,
+      spike_neighbour_comm_,
+      &spike_data_request_ );
+  }
+  else
+  {
+    MPI_Neighbor_alltoallv( send_buffer,
+      spike_send_counts_.data(),
+      spike_send_displacements_.data(),
+      MPI_UNSIGNED,
+      recv_buffer,
+      spike_recv_counts_.data(),
+      spike_recv_displacements_.data(),
+      MPI_UNSIGNED,
+      spike_neighbour_comm_ );
+  }
+}
+
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &spike_data_request_ );
+}
+
+void
+nest::MPIManager::create_spike_node_comms_()
+{
+  if ( ranks_per_node_ > 0 )
+  {
+    // consecutive ranks form a node, which allows to test the exchange
+    // with any number of ranks on a single machine
+    MPI_Comm_split( comm, static_cast< int >( get_rank() / ranks_per_node_ ), get_rank(), &spike_node_comm_ );
+  }
+  else
+  {
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, get_rank(), MPI_INFO_NULL, &spike_node_comm_ );
+  }
+
+  int node_rank;
+  MPI_Comm_rank( spike_node_comm_, &node_rank );
+  spike_node_rank_ = node_rank;
+
+  MPI_Comm_split( comm, node_rank == 0 ? 0 : MPI_UNDEFINED, get_rank(), &spike_leader_comm_ );
+
+  // nodes are numbered by the rank of their leader among all leaders
+  int node = 0;
+  if ( spike_leader_comm_ != MPI_COMM_NULL )
+  {
+    MPI_Comm_rank( spike_leader_comm_, &node );
+  }
+  MPI_Bcast( &node, 1, MPI_INT, 0, spike_node_comm_ );
+  spike_node_ = node;
+
+  std::vector< int > node_of_rank( get_num_processes() );
+  MPI_Allgather( &node, 1, MPI_INT, &node_of_rank[ 0 ], 1, MPI_INT, comm );
+
+  const int num_nodes = *std::max_element( node_of_rank.begin(), node_of_rank.end() ) + 1;
+  spike_node_ranks_.assign( num_nodes, std::vector< int >() );
+  for ( thread rank = 0; rank < get_num_processes(); ++rank )
+  {
+    spike_node_ranks_[ node_of_rank[ rank ] ].push_back( rank );
+  }
+
+  spike_leader_counts_.resize( num_nodes );
+  spike_leader_displacements_.resize( num_nodes );
+}
+
+void
+nest::MPIManager::free_spike_node_comms_()
+{
+  free_spike_windows_();
+
+  int finalized;
+  MPI_Finalized( &finalized );
+
+  if ( spike_leader_comm_ != MPI_COMM_NULL and finalized == 0 )
+  {
+    MPI_Comm_free( &spike_leader_comm_ );
+  }
+  if ( spike_node_comm_ != MPI_COMM_NULL and finalized == 0 )
+  {
+    MPI_Comm_free( &spike_node_comm_ );
+  }
+  spike_leader_comm_ = MPI_COMM_NULL;
+  spike_node_comm_ = MPI_COMM_NULL;
+  spike_node_ranks_.clear();
+}
+
+void
+nest::MPIManager::allocate_spike_windows_( const unsigned int send_recv_count )
+{
+  free_spike_windows_();
+
+  const size_t num_local_ranks = spike_node_ranks_[ spike_node_ ].size();
+  const size_t num_remote_ranks = get_num_processes() - num_local_ranks;
+
+  // every rank shares its full send buffer with the node
+  unsigned int* base;
+  const MPI_Aint send_size = sizeof( unsigned int ) * send_recv_count * get_num_processes();
+  MPI_Win_allocate_shared(
+    send_size, sizeof( unsigned int ), MPI_INFO_NULL, spike_node_comm_, &base, &spike_send_win_ );
+
+  spike_send_segments_.resize( num_local_ranks );
+  for ( size_t i = 0; i < num_local_ranks; ++i )
+  {
+    MPI_Aint size;
+    int disp_unit;
+    MPI_Win_shared_query( spike_send_win_, i, &size, &disp_unit, &spike_send_segments_[ i ] );
+  }
+
+  // only the leader receives chunks from other nodes, one per pair of
+  // a remote and a local rank
+  const MPI_Aint recv_size =
+    spike_node_rank_ == 0 ? sizeof( unsigned int ) * send_recv_count * num_remote_ranks * num_local_ranks : 0;
+  MPI_Win_allocate_shared(
+    recv_size, sizeof( unsigned int ), MPI_INFO_NULL, spike_node_comm_, &base, &spike_recv_win_ );
+  MPI_Aint size;
+  int disp_unit;
+  MPI_Win_shared_query( spike_recv_win_, 0, &size, &disp_unit, &spike_recv_segment_ );
+
+  // the windows are only accessed by load and store, synchronized by
+  // sync_spike_windows_()
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, spike_send_win_ );
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, spike_recv_win_ );
+
+  spike_win_count_ = send_recv_count;
+}
+
+void
+nest::MPIManager::free_spike_windows_()
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+
+  if ( spike_send_win_ != MPI_WIN_NULL and finalized == 0 )
+  {
+    MPI_Win_unlock_all( spike_send_win_ );
+    MPI_Win_free( &spike_send_win_ );
+  }
+  if ( spike_recv_win_ != MPI_WIN_NULL and finalized == 0 )
+  {
+    MPI_Win_unlock_all( spike_recv_win_ );
+    MPI_Win_free( &spike_recv_win_ );
+  }
+  spike_send_win_ = MPI_WIN_NULL;
+  spike_recv_win_ = MPI_WIN_NULL;
+  spike_send_segments_.clear();
+  spike_recv_segment_ = 0;
+  spike_win_count_ = 0;
+}
+
+void
+nest::MPIManager::sync_spike_windows_()
+{
+  // make the stores of all ranks on the node visible to each other
+  MPI_Win_sync( spike_send_win_ );
+  MPI_Win_sync( spike_recv_win_ );
+  MPI_Barrier( spike_node_comm_ );
+  MPI_Win_sync( spike_send_win_ );
+  MPI_Win_sync( spike_recv_win_ );
+}
+
+void
+nest::MPIManager::communicate_Hierarchical_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  // all ranks get here in the same communication round, so the
+  // collective creation of communicators and windows is safe
+  if ( spike_node_comm_ == MPI_COMM_NULL )
+  {
+    create_spike_node_comms_();
+  }
+  if ( spike_win_count_ != send_recv_count )
+  {
+    allocate_spike_windows_( send_recv_count );
+  }
+
+  const unsigned int* send = static_cast< unsigned int* >( send_buffer );
+  unsigned int* recv = static_cast< unsigned int* >( recv_buffer );
+  const std::vector< int >& local_ranks = spike_node_ranks_[ spike_node_ ];
+  const size_t num_local_ranks = local_ranks.size();
+  const size_t num_nodes = spike_node_ranks_.size();
+
+  std::copy( send, send + send_recv_count * get_num_processes(), spike_send_segments_[ spike_node_rank_ ] );
+  sync_spike_windows_();
+
+  // chunks from ranks on the same node are read from their segments
+  for ( size_t i = 0; i < num_local_ranks; ++i )
+  {
+    const unsigned int* chunk = spike_send_segments_[ i ] + get_rank() * send_recv_count;
+    std::copy( chunk, chunk + send_recv_count, recv + local_ranks[ i ] * send_recv_count );
+  }
+
+  // Leaders of nodes n and m exchange the chunks from each rank on n to
+  // each rank on m, ordered by source and then by target rank. The
+  // counts are symmetric, so they serve for sending and receiving.
+  int displacement = 0;
+  for ( size_t node = 0; node < num_nodes; ++node )
+  {
+    spike_leader_counts_[ node ] =
+      node == spike_node_ ? 0 : send_recv_count * num_local_ranks * spike_node_ranks_[ node ].size();
+    spike_leader_displacements_[ node ] = displacement;
+    displacement += spike_leader_counts_[ node ];
+  }
+
+  if ( spike_node_rank_ == 0 and num_nodes > 1 )
+  {
+    spike_leader_send_buffer_.resize( displacement );
+    unsigned int* packed = &spike_leader_send_buffer_[ 0 ];
+    for ( size_t node = 0; node < num_nodes; ++node )
+    {
+      if ( node == spike_node_ )
+      {
+        continue;
+      }
+      for ( size_t i = 0; i < num_local_ranks; ++i )
+      {
+        for ( const int target_rank : spike_node_ranks_[ node ] )
+        {
+          const unsigned int* chunk = spike_send_segments_[ i ] + target_rank * send_recv_count;
+          packed = std::copy( chunk, chunk + send_recv_count, packed );
+        }
+      }
+    }
+
+    MPI_Alltoallv( &spike_leader_send_buffer_[ 0 ],
+      &spike_leader_counts_[ 0 ],
+      &spike_leader_displacements_[ 0 ],
+      MPI_UNSIGNED,
+      spike_recv_segment_,
+      &spike_leader_counts_[ 0 ],
+      &spike_leader_displacements_[ 0 ],
+      MPI_UNSIGNED,
+      spike_leader_comm_ );
+  }
+  sync_spike_windows_();
+
+  // chunks from ranks on other nodes are read from the segment of the leader
+  for ( size_t node = 0; node < num_nodes; ++node )
+  {
+    if ( node == spike_node_ )
+    {
+      continue;
+    }
+    const unsigned int* chunks = spike_recv_segment_ + spike_leader_displacements_[ node ];
+    for ( size_t j = 0; j < spike_node_ranks_[ node ].size(); ++j )
+    {
+      const unsigned int* chunk = chunks + ( j * num_local_ranks + spike_node_rank_ ) * send_recv_count;
+      std::copy( chunk, chunk + send_recv_count, recv + spike_node_ranks_[ node ][ j ] * send_recv_count );
+    }
+  }
+
+  // the segments may only be overwritten after all ranks have read them
+  MPI_Barrier( spike_node_comm_ );
+}
+
+void
+nest::MPIManager::communicate_counts( const std::vector< int >& send_counts,
+  std::vector< int >& recv_counts )
+{
+  assert( send_counts.size() == static_cast< size_t >( get_num_processes() ) );
+  recv_counts.resize( get_num_processes() );
+  MPI_Alltoall( &send_counts[ 0 ], 1, MPI_INT, &recv_counts[ 0 ], 1, MPI_INT, comm );
+}
+
+void
+nest::MPIManager::wait_spike_data()
+{
+  // MPI_Wait resets the request to MPI_REQUEST_NULL and returns
+  // immediately for a null request
+  MPI_Wait( &spike_data_request_, MPI_STATUS_IGNORE );
+  wait_persistent_exchange_( spike_data_exchange_ );
+}
+
+nest::MPIManager::PersistentExchange::PersistentExchange( const int tag )
+  : send_buffer( 0 )
+  , recv_buffer( 0 )
+  , send_recv_count( 0 )
+  , tag( tag )
+  , created( false )
+{
+}
+
+void
+nest::MPIManager::start_persistent_exchange_( PersistentExchange& exchange,
+  void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  if ( not exchange.created or not exchange.send_counts.empty() or send_buffer != exchange.send_buffer
+    or recv_buffer != exchange.recv_buffer or send_recv_count != exchange.send_recv_count )
+  {
+    free_persistent_exchange_( exchange );
+    exchange.send_buffer = send_buffer;
+    exchange.recv_buffer = recv_buffer;
+    exchange.send_recv_count = send_recv_count;
+    create_persistent_requests_( exchange );
+  }
+
+  MPI_Startall( exchange.requests.size(), exchange.requests.data() );
+}
+
+void
+nest::MPIManager::start_persistent_exchange_( PersistentExchange& exchange,
+  void* send_buffer,
+  const int* send_counts,
+  const int* send_displacements,
+  void* recv_buffer,
+  const int* recv_counts,
+  const int* recv_displacements )
+{
+  const size_t num_processes = get_num_processes();
+  if ( not exchange.created or exchange.send_counts.empty() or send_buffer != exchange.send_buffer
+    or recv_buffer != exchange.recv_buffer
+    or not std::equal( send_counts, send_counts + num_processes, exchange.send_counts.begin() )
+    or not std::equal( send_displacements, send_displacements + num_processes, exchange.send_displacements.begin() )
+    or not std::equal( recv_counts, recv_counts + num_processes, exchange.recv_counts.begin() )
+    or not std::equal( recv_displacements, recv_displacements + num_processes, exchange.recv_displacements.begin() ) )
+  {
+    free_persistent_exchange_( exchange );
+    exchange.send_buffer = send_buffer;
+    exchange.recv_buffer = recv_buffer;
+    exchange.send_counts.assign( send_counts, send_counts + num_processes );
+    exchange.send_displacements.assign( send_displacements, send_displacements + num_processes );
+    exchange.recv_counts.assign( recv_counts, recv_counts + num_processes );
+    exchange.recv_displacements.assign( recv_displacements, recv_displacements + num_processes );
+    create_persistent_requests_( exchange );
+  }
+
+  MPI_Startall( exchange.requests.size(), exchange.requests.data() );
+}
+
+void
+nest::MPIManager::create_persistent_requests_( PersistentExchange& exchange )
+{
+  assert( exchange.requests.empty() );
+  const bool equal_chunks = exchange.send_counts.empty();
 
-  std::vector< int > all_int( get_num_processes() );
-  MPI_Allgather( &my_int, 1, MPI_INT, &all_int[ 0 ], 1, MPI_INT, comm );
-  // check if any MPI process sent a "true"
-  for ( unsigned int i = 0; i < all_int.size(); ++i )
+#if MPI_VERSION >= 4
+  exchange.requests.resize( 1 );
+  if ( equal_chunks )
+  {
+    MPI_Alltoall_init( exchange.send_buffer,
+      exchange.send_recv_count,
+      MPI_UNSIGNED,
+      exchange.recv_buffer,
+      exchange.send_recv_count,
+      MPI_UNSIGNED,
+      comm,
+      MPI_INFO_NULL,
+      &exchange.requests[ 0 ] );
+  }
+  else
   {
-    if ( all_int[ i ] != 0 )
+    MPI_Alltoallv_init( exchange.send_buffer,
+      exchange.send_counts.data(),
+      exchange.send_displacements.data(),
+      MPI_UNSIGNED,
+      exchange.recv_buffer,
+      exchange.recv_counts.data(),
+      exchange.recv_displacements.data(),
+      MPI_UNSIGNED,
+      comm,
+      MPI_INFO_NULL,
+      &exchange.requests[ 0 ] );
+  }
+#else
+  // Persistent collectives are not available before MPI 4, fall back
+  // to persistent point-to-point requests. All receives precede all
+  // sends, so that MPI_Startall posts the receives first.
+  unsigned int* const send_buffer = static_cast< unsigned int* >( exchange.send_buffer );
+  unsigned int* const recv_buffer = static_cast< unsigned int* >( exchange.recv_buffer );
+  for ( int rank = 0; rank < get_num_processes(); ++rank )
+  {
+    const int count = equal_chunks ? exchange.send_recv_count : exchange.recv_counts[ rank ];
+    const int displacement = equal_chunks ? rank * exchange.send_recv_count : exchange.recv_displacements[ rank ];
+    if ( count > 0 )
     {
-      return true;
+      exchange.requests.push_back( MPI_REQUEST_NULL );
+      MPI_Recv_init(
+        recv_buffer + displacement, count, MPI_UNSIGNED, rank, exchange.tag, comm, &exchange.requests.back() );
     }
   }
+  for ( int rank = 0; rank < get_num_processes(); ++rank )
+  {
+    const int count = equal_chunks ? exchange.send_recv_count : exchange.send_counts[ rank ];
+    const int displacement = equal_chunks ? rank * exchange.send_recv_count : exchange.send_displacements[ rank ];
+    if ( count > 0 )
+    {
+      exchange.requests.push_back( MPI_REQUEST_NULL );
+      MPI_Send_init(
+        send_buffer + displacement, count, MPI_UNSIGNED, rank, exchange.tag, comm, &exchange.requests.back() );
+    }
+  }
+#endif
 
-  return false;
+  exchange.created = true;
+}
+
+void
+nest::MPIManager::wait_persistent_exchange_( PersistentExchange& exchange )
+{
+  // MPI_Waitall returns immediately for inactive persistent requests
+  MPI_Waitall( exchange.requests.size(), exchange.requests.data(), MPI_STATUSES_IGNORE );
+}
+
+void
+nest::MPIManager::free_persistent_exchange_( PersistentExchange& exchange )
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+
+  if ( finalized == 0 )
+  {
+    for ( std::vector< MPI_Request >::iterator it = exchange.requests.begin(); it != exchange.requests.end(); ++it )
+    {
+      MPI_Request_free( &( *it ) );
+    }
+  }
+  exchange.requests.clear();
+  exchange.send_counts.clear();
+  exchange.send_displacements.clear();
+  exchange.recv_counts.clear();
+  exchange.recv_displacements.clear();
+  exchange.created = false;
 }
 
 // average communication time for a packet size of num_bytes using Allgather
@@ -986,6 +1798,54 @@ nest::MPIManager::time_communicate_alltoallv( int num_bytes, int samples )
   return foo.elapsed() / samples;
 }
 
+// average communication time for num_entries entries of a buffer of
+// type D per rank using Alltoall or, if counted, Alltoall of the
+// counts and Alltoallv
+template < class D >
+double
+nest::MPIManager::time_communicate_buffer_( const bool counted, const int num_entries, const int samples )
+{
+  if ( get_num_processes() == 1 )
+  {
+    return 0.0;
+  }
+  const int count_per_rank = std::max( num_entries, 1 );
+  std::vector< D > test_send_buffer( count_per_rank * get_num_processes() );
+  std::vector< D > test_recv_buffer( count_per_rank * get_num_processes() );
+  std::vector< int > send_counts( get_num_processes(), count_per_rank );
+  std::vector< int > recv_counts( get_num_processes(), 0 );
+  std::vector< int > displacements( get_num_processes(), 0 );
+
+  for ( int i = 1; i < get_num_processes(); ++i )
+  {
+    displacements[ i ] = displacements[ i - 1 ] + count_per_rank;
+  }
+
+  // start all ranks together, such that the first samples do not
+  // include waiting for other ranks
+  synchronize();
+
+  // start time measurement here
+  Stopwatch foo;
+  foo.start();
+  for ( int i = 0; i < samples; ++i )
+  {
+    if ( counted )
+    {
+      communicate_counts( send_counts, recv_counts );
+      communicate_Alltoallv(
+        test_send_buffer, send_counts, displacements, test_recv_buffer, recv_counts, displacements );
+    }
+    else
+    {
+      communicate_Alltoall( test_send_buffer, test_recv_buffer, count_per_rank * sizeof( D ) / sizeof( unsigned int ) );
+    }
+  }
+  // finish time measurement here
+  foo.stop();
+  return foo.elapsed() / samples;
+}
+
 #else /* #ifdef HAVE_MPI */
 
 /**
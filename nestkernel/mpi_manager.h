@@ -33,6 +33,7 @@
 #endif
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
@@ -235,6 +236,69 @@ public:
   void communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
   template < class D >
   void communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Start the exchange of spike data without waiting for it to finish.
+   * The buffers must not be touched until wait_spike_data() returns.
+   */
+  template < class D >
+  void start_communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void start_communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer );
+
+  /**
+   * Wait for the exchange started by start_communicate_*spike_data_Alltoall.
+   * Returns immediately if no exchange is in flight.
+   */
+  void wait_spike_data();
+
+  /**
+   * Returns whether each thread exchanges the spike data of its
+   * assigned ranks, see communicate_spike_data_of_ranks().
+   */
+  bool thread_parallel_spike_exchange() const;
+
+  /**
+   * Prepare the thread-parallel spike exchange for the current number
+   * of threads. Must be called by a single thread on all ranks before
+   * communicate_spike_data_of_ranks().
+   */
+  void prepare_thread_parallel_spike_exchange();
+
+  /**
+   * Exchange the chunks of spike data for and from the ranks in
+   * [begin_rank, end_rank) by point-to-point messages. Called
+   * concurrently by all threads, each with its assigned ranks, which
+   * requires MPI_THREAD_MULTIPLE. Returns once the chunks of these
+   * ranks have arrived; the threads must synchronize before reading the
+   * chunks of other ranks.
+   */
+  template < class D >
+  void communicate_spike_data_of_ranks( const thread tid,
+    std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const thread begin_rank,
+    const thread end_rank );
+
+  /**
+   * Exchange the number of entries sent to each rank, such that
+   * recv_counts holds the number of entries received from each rank.
+   * Used by the alltoallv protocol and the counted target data exchange.
+   */
+  void communicate_counts( const std::vector< int >& send_counts, std::vector< int >& recv_counts );
+
+  /**
+   * Exchange exactly sized chunks of spike or target data. Counts and
+   * displacements are given in entries of D.
+   */
+  template < class D >
+  void communicate_Alltoallv( std::vector< D >& send_buffer,
+    const std::vector< int >& send_counts,
+    const std::vector< int >& send_displacements,
+    std::vector< D >& recv_buffer,
+    const std::vector< int >& recv_counts,
+    const std::vector< int >& recv_displacements );
   template < class D >
   void communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
@@ -242,6 +306,28 @@ public:
 
   bool any_true( const bool );
 
+  /**
+   * Protocols for the exchange of spike data between ranks, selected
+   * by the kernel parameter spike_exchange.
+   */
+  enum SpikeExchange
+  {
+    SPIKE_EXCHANGE_ALLTOALL,    //!< MPI_Alltoall of the chunks for all ranks
+    SPIKE_EXCHANGE_SPARSE,      //!< neighbourhood collective with ranks that host targets or sources
+    SPIKE_EXCHANGE_ALLTOALLV,   //!< MPI_Alltoallv of exactly sized chunks after an exchange of counts
+    SPIKE_EXCHANGE_HIERARCHICAL //!< shared memory within nodes, MPI_Alltoallv between one leader per node
+  };
+
+  SpikeExchange get_spike_exchange() const;
+
+  /**
+   * Set the ranks that host targets of neurons on this rank, given as
+   * one flag per rank, and determine the ranks that host sources of
+   * neurons on this rank. Must be called by all ranks whenever the
+   * connection infrastructure has been updated.
+   */
+  void set_spike_target_ranks( const std::vector< int >& is_target_rank );
+
   /**
    * Benchmark communication time of different MPI methods
    *
@@ -254,6 +340,18 @@ public:
   double time_communicate_alltoall( int num_bytes, int samples = 1000 );
   double time_communicate_alltoallv( int num_bytes, int samples = 1000 );
 
+  /**
+   * Benchmark the exchange of the MPI buffers used during simulation.
+   *
+   * Returns the average time of exchanging num_entries entries of the
+   * given buffer type (spike_data, off_grid_spike_data, target_data or
+   * secondary_events) with each rank. The buffers are exchanged in
+   * equal chunks by MPI_Alltoall, as with spike_exchange "alltoall",
+   * or, if counted, by an exchange of counts followed by
+   * MPI_Alltoallv, as with spike_exchange "alltoallv".
+   */
+  double time_communicate_buffer( const Name& buffer_type, const bool counted, int num_entries, int samples = 1000 );
+
   void set_buffer_size_target_data( size_t buffer_size );
   void set_buffer_size_spike_data( size_t buffer_size );
 
@@ -275,6 +373,24 @@ public:
    */
   void decrease_buffer_size_spike_data();
 
+  /**
+   * Returns whether the size of the MPI buffer for communication of
+   * spikes is predicted from the spike counts of recent time slices
+   * instead of being decreased after each slice without overflow.
+   */
+  bool predict_buffer_size_spike_data() const;
+
+  /**
+   * Records the largest number of spikes this rank sent to a single
+   * rank in the time slice that just ended. After
+   * spike_buffer_history_length slices, or after a slice that needed
+   * more than one round, sizes the MPI buffer for communication of
+   * spikes to the configured quantile of the recorded counts across
+   * all ranks. Must be called by all ranks. Returns whether the size
+   * was changed.
+   */
+  bool update_buffer_size_spike_data( const size_t max_spike_count, const bool overflow );
+
   /**
    * Returns whether MPI buffers for communication of connections are adaptive.
    */
@@ -357,9 +473,56 @@ private:
 
   double shrink_factor_buffer_spike_data_;
 
+  //! Quantile of the spike counts of recent time slices to which the
+  //! MPI buffer for communication of spikes is sized; 0 to decrease it
+  //! by shrink_factor_buffer_spike_data_ instead
+  double spike_buffer_quantile_;
+  //! Number of time slices whose spike counts are recorded
+  long spike_buffer_history_length_;
+  //! Largest number of spikes sent to a single rank in each recent
+  //! time slice, ring buffer of spike_buffer_history_length_ entries
+  std::vector< size_t > spike_count_history_;
+  //! Position of the next entry in spike_count_history_
+  size_t spike_count_history_pos_;
+  //! Number of valid entries in spike_count_history_
+  size_t spike_count_history_size_;
+  //! Number of time slices recorded since the last update of the buffer size
+  size_t slices_since_spike_buffer_update_;
+  //! Scratch space to determine the quantile of spike_count_history_
+  std::vector< size_t > spike_count_quantile_buffer_;
+
+  void reset_spike_count_history_();
+
   unsigned int send_recv_count_spike_data_per_rank_;
   unsigned int send_recv_count_target_data_per_rank_;
 
+  SpikeExchange spike_exchange_; //!< protocol for the exchange of spike data
+
+  //! Number of consecutive ranks that form a node in the hierarchical
+  //! spike exchange, 0 to group all ranks that share memory
+  long ranks_per_node_;
+
+  //! Whether spike data and secondary events are exchanged through
+  //! persistent requests
+  bool persistent_mpi_requests_;
+
+  //! Whether each thread exchanges the spike data of its assigned ranks
+  bool thread_parallel_spike_exchange_;
+
+  //! Whether MPI provides MPI_THREAD_MULTIPLE
+  bool mpi_thread_multiple_;
+
+  /**
+   * Exchange chunks of spike data of send_recv_count ints per rank
+   * using the protocol selected by spike_exchange_. If nonblocking is
+   * true, only start the exchange, see wait_spike_data().
+   */
+  template < class D >
+  void communicate_spike_data_( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count,
+    const bool nonblocking );
+
   std::vector< int > recv_counts_secondary_events_in_int_per_rank_; //!< how many secondary elements (in ints) will be
                                                                     //!< received from each rank
   std::vector< int >
@@ -382,6 +545,130 @@ private:
   MPI_Comm comm;
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Ranks other than this one that host targets of neurons on this rank
+  std::vector< int > spike_target_ranks_;
+  //! Ranks other than this one that host sources of neurons on this rank
+  std::vector< int > spike_source_ranks_;
+  //! Whether each rank is in spike_source_ranks_
+  std::vector< bool > is_spike_source_rank_;
+
+  //! Arguments of MPI_Neighbor_alltoallv for sparse spike exchange (in ints)
+  std::vector< int > spike_send_counts_;
+  std::vector< int > spike_send_displacements_;
+  std::vector< int > spike_recv_counts_;
+  std::vector< int > spike_recv_displacements_;
+
+  //! Distributed graph communicator from spike_source_ranks_ to
+  //! spike_target_ranks_; created on first use, MPI_COMM_NULL before
+  MPI_Comm spike_neighbour_comm_;
+
+  void reset_spike_exchange_ranks_();
+  void free_spike_neighbour_comm_();
+
+  //! Duplicate of comm for the thread-parallel spike exchange, which
+  //! keeps its messages apart from all other communication;
+  //! MPI_COMM_NULL before first use
+  MPI_Comm spike_thread_comm_;
+  //! Requests of the thread-parallel spike exchange of each thread
+  std::vector< std::vector< MPI_Request > > spike_thread_requests_;
+
+  void free_spike_thread_comm_();
+
+  void communicate_Neighbor_alltoall_( void* send_buffer,
+    void* recv_buffer,
+    const unsigned int send_recv_count,
+    const bool nonblocking );
+
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  //! Counts and displacements of communicate_Alltoallv() (in ints)
+  std::vector< int > alltoallv_send_counts_in_int_;
+  std::vector< int > alltoallv_send_displacements_in_int_;
+  std::vector< int > alltoallv_recv_counts_in_int_;
+  std::vector< int > alltoallv_recv_displacements_in_int_;
+
+  //! Request of the spike exchange in flight, MPI_REQUEST_NULL if none
+  MPI_Request spike_data_request_;
+
+  /**
+   * Persistent requests of an exchange between a fixed pair of buffers.
+   *
+   * The requests are created on the first start and kept until the
+   * buffers or counts change, i.e., until a buffer is resized. With
+   * MPI 4 they are a persistent collective, otherwise one persistent
+   * send and receive per rank with a non-empty chunk.
+   */
+  struct PersistentExchange
+  {
+    explicit PersistentExchange( const int tag );
+
+    void* send_buffer;
+    void* recv_buffer;
+    //! Count per rank (in ints) if all ranks exchange equal chunks
+    unsigned int send_recv_count;
+    //! Counts and displacements (in ints) otherwise; empty for equal chunks
+    std::vector< int > send_counts;
+    std::vector< int > send_displacements;
+    std::vector< int > recv_counts;
+    std::vector< int > recv_displacements;
+    std::vector< MPI_Request > requests;
+    const int tag; //!< tag of the point-to-point requests
+    bool created;  //!< whether requests hold the requests for the above
+  };
+
+  PersistentExchange spike_data_exchange_;
+  PersistentExchange secondary_events_exchange_;
+
+  void start_persistent_exchange_( PersistentExchange& exchange,
+    void* send_buffer,
+    void* recv_buffer,
+    const unsigned int send_recv_count );
+  void start_persistent_exchange_( PersistentExchange& exchange,
+    void* send_buffer,
+    const int* send_counts,
+    const int* send_displacements,
+    void* recv_buffer,
+    const int* recv_counts,
+    const int* recv_displacements );
+  void create_persistent_requests_( PersistentExchange& exchange );
+  void wait_persistent_exchange_( PersistentExchange& exchange );
+  void free_persistent_exchange_( PersistentExchange& exchange );
+
+  //! Ranks on the same node for hierarchical spike exchange; created on
+  //! first use, MPI_COMM_NULL before
+  MPI_Comm spike_node_comm_;
+  //! Lowest rank of each node; MPI_COMM_NULL on all other ranks
+  MPI_Comm spike_leader_comm_;
+  //! Ranks on each node in ascending order, nodes ordered by their leader
+  std::vector< std::vector< int > > spike_node_ranks_;
+  size_t spike_node_;      //!< node of this rank
+  size_t spike_node_rank_; //!< rank within spike_node_comm_
+
+  //! Shared segments holding the send buffer of each rank on the node
+  MPI_Win spike_send_win_;
+  //! Shared segment of the leader holding the chunks from other nodes
+  MPI_Win spike_recv_win_;
+  std::vector< unsigned int* > spike_send_segments_; //!< send segment of each rank on the node
+  unsigned int* spike_recv_segment_;                  //!< receive segment of the leader
+  unsigned int spike_win_count_;                      //!< send_recv_count the windows are allocated for
+
+  //! Chunks of all ranks on the node for other nodes, packed by the leader
+  std::vector< unsigned int > spike_leader_send_buffer_;
+  //! Counts and displacements of the exchange between leaders (in ints)
+  std::vector< int > spike_leader_counts_;
+  std::vector< int > spike_leader_displacements_;
+
+  void create_spike_node_comms_();
+  void free_spike_node_comms_();
+  void allocate_spike_windows_( const unsigned int send_recv_count );
+  void free_spike_windows_();
+  void sync_spike_windows_();
+
+  void communicate_Hierarchical_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  template < class D >
+  double time_communicate_buffer_( const bool counted, const int num_entries, const int samples );
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -676,6 +963,12 @@ MPIManager::decrease_buffer_size_spike_data()
   }
 }
 
+inline bool
+MPIManager::predict_buffer_size_spike_data() const
+{
+  return adaptive_spike_buffers_ and spike_buffer_quantile_ > 0.;
+}
+
 inline bool
 MPIManager::adaptive_target_buffers() const
 {
@@ -688,6 +981,18 @@ MPIManager::adaptive_spike_buffers() const
   return adaptive_spike_buffers_;
 }
 
+inline MPIManager::SpikeExchange
+MPIManager::get_spike_exchange() const
+{
+  return spike_exchange_;
+}
+
+inline bool
+MPIManager::thread_parallel_spike_exchange() const
+{
+  return thread_parallel_spike_exchange_ and spike_exchange_ == SPIKE_EXCHANGE_ALLTOALL and num_processes_ > 1;
+}
+
 #ifndef HAVE_MPI
 inline std::string
 MPIManager::get_processor_name()
@@ -734,6 +1039,27 @@ MPIManager::any_true( const bool my_bool )
   return my_bool;
 }
 
+inline void
+MPIManager::set_spike_target_ranks( const std::vector< int >& )
+{
+}
+
+inline void
+MPIManager::wait_spike_data()
+{
+}
+
+inline void
+MPIManager::prepare_thread_parallel_spike_exchange()
+{
+}
+
+inline void
+MPIManager::communicate_counts( const std::vector< int >& send_counts, std::vector< int >& recv_counts )
+{
+  recv_counts = send_counts;
+}
+
 inline double
 MPIManager::time_communicate( int, int )
 {
@@ -786,6 +1112,19 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
   void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
   void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
 
+  if ( persistent_mpi_requests_ )
+  {
+    start_persistent_exchange_( secondary_events_exchange_,
+      send_buffer_int,
+      &send_counts_secondary_events_in_int_per_rank_[ 0 ],
+      &send_displacements_secondary_events_in_int_per_rank_[ 0 ],
+      recv_buffer_int,
+      &recv_counts_secondary_events_in_int_per_rank_[ 0 ],
+      &recv_displacements_secondary_events_in_int_per_rank_[ 0 ] );
+    wait_persistent_exchange_( secondary_events_exchange_ );
+    return;
+  }
+
   communicate_Alltoallv_( send_buffer_int,
     &send_counts_secondary_events_in_int_per_rank_[ 0 ],
     &send_displacements_secondary_events_in_int_per_rank_[ 0 ],
@@ -794,6 +1133,149 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
     &recv_displacements_secondary_events_in_int_per_rank_[ 0 ] );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >& send_counts,
+  const std::vector< int >& send_displacements,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >& recv_counts,
+  const std::vector< int >& recv_displacements )
+{
+  const int ints_per_entry = sizeof( D ) / sizeof( unsigned int );
+  for ( thread rank = 0; rank < get_num_processes(); ++rank )
+  {
+    alltoallv_send_counts_in_int_[ rank ] = ints_per_entry * send_counts[ rank ];
+    alltoallv_send_displacements_in_int_[ rank ] = ints_per_entry * send_displacements[ rank ];
+    alltoallv_recv_counts_in_int_[ rank ] = ints_per_entry * recv_counts[ rank ];
+    alltoallv_recv_displacements_in_int_[ rank ] = ints_per_entry * recv_displacements[ rank ];
+  }
+
+  communicate_Alltoallv_( static_cast< void* >( &send_buffer[ 0 ] ),
+    &alltoallv_send_counts_in_int_[ 0 ],
+    &alltoallv_send_displacements_in_int_[ 0 ],
+    static_cast< void* >( &recv_buffer[ 0 ] ),
+    &alltoallv_recv_counts_in_int_[ 0 ],
+    &alltoallv_recv_displacements_in_int_[ 0 ] );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count,
+  const bool nonblocking )
+{
+  if ( spike_exchange_ == SPIKE_EXCHANGE_ALLTOALL )
+  {
+    if ( persistent_mpi_requests_ )
+    {
+      start_persistent_exchange_( spike_data_exchange_,
+        static_cast< void* >( &send_buffer[ 0 ] ),
+        static_cast< void* >( &recv_buffer[ 0 ] ),
+        send_recv_count );
+      if ( not nonblocking )
+      {
+        wait_persistent_exchange_( spike_data_exchange_ );
+      }
+    }
+    else if ( nonblocking )
+    {
+      communicate_Ialltoall_(
+        static_cast< void* >( &send_buffer[ 0 ] ), static_cast< void* >( &recv_buffer[ 0 ] ), send_recv_count );
+    }
+    else
+    {
+      communicate_Alltoall( send_buffer, recv_buffer, send_recv_count );
+    }
+    return;
+  }
+
+  if ( spike_exchange_ == SPIKE_EXCHANGE_HIERARCHICAL )
+  {
+    // the exchange within nodes uses barriers, so it always blocks
+    assert( not nonblocking );
+    communicate_Hierarchical_(
+      static_cast< void* >( &send_buffer[ 0 ] ), static_cast< void* >( &recv_buffer[ 0 ] ), send_recv_count );
+    return;
+  }
+
+  assert( spike_exchange_ == SPIKE_EXCHANGE_SPARSE );
+
+  // Only chunks of neighbouring ranks are communicated. The chunk of
+  // this rank is copied, and the chunks of all other ranks are marked
+  // as empty and complete, as those ranks never send spikes here.
+  const size_t count_per_rank = send_recv_count_spike_data_per_rank_;
+  for ( thread rank = 0; rank < get_num_processes(); ++rank )
+  {
+    if ( rank == get_rank() )
+    {
+      std::copy( send_buffer.begin() + rank * count_per_rank,
+        send_buffer.begin() + ( rank + 1 ) * count_per_rank,
+        recv_buffer.begin() + rank * count_per_rank );
+    }
+    else if ( not is_spike_source_rank_[ rank ] )
+    {
+      recv_buffer[ rank * count_per_rank ].set_invalid_marker();
+      recv_buffer[ ( rank + 1 ) * count_per_rank - 1 ].set_complete_marker();
+    }
+  }
+
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Neighbor_alltoall_( send_buffer_int, recv_buffer_int, send_recv_count, nonblocking );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_of_ranks( const thread tid,
+  std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const thread begin_rank,
+  const thread end_rank )
+{
+  const size_t count_per_rank = send_recv_count_spike_data_per_rank_;
+  const int send_recv_count = sizeof( D ) / sizeof( unsigned int ) * count_per_rank;
+
+  // All receives and sends are posted before waiting, such that
+  // threads on different ranks cannot block each other.
+  std::vector< MPI_Request >& requests = spike_thread_requests_[ tid ];
+  requests.clear();
+  for ( thread rank = begin_rank; rank < end_rank; ++rank )
+  {
+    if ( rank == get_rank() )
+    {
+      std::copy( send_buffer.begin() + rank * count_per_rank,
+        send_buffer.begin() + ( rank + 1 ) * count_per_rank,
+        recv_buffer.begin() + rank * count_per_rank );
+      continue;
+    }
+
+    requests.push_back( MPI_REQUEST_NULL );
+    MPI_Irecv( &recv_buffer[ rank * count_per_rank ],
+      send_recv_count,
+      MPI_UNSIGNED,
+      rank,
+      0,
+      spike_thread_comm_,
+      &requests.back() );
+    requests.push_back( MPI_REQUEST_NULL );
+    MPI_Isend( &send_buffer[ rank * count_per_rank ],
+      send_recv_count,
+      MPI_UNSIGNED,
+      rank,
+      0,
+      spike_thread_comm_,
+      &requests.back() );
+  }
+
+  if ( not requests.empty() )
+  {
+    MPI_Waitall( requests.size(), &requests[ 0 ], MPI_STATUSES_IGNORE );
+  }
+}
+
 #else // HAVE_MPI
 template < class D >
 void
@@ -811,6 +1293,47 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >& send_counts,
+  const std::vector< int >&,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >&,
+  const std::vector< int >& )
+{
+  std::copy( send_buffer.begin(), send_buffer.begin() + send_counts[ 0 ], recv_buffer.begin() );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count,
+  const bool )
+{
+  // with a single rank, all protocols reduce to handing over the
+  // buffer, which completes immediately
+  communicate_Alltoall( send_buffer, recv_buffer, send_recv_count );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_of_ranks( const thread,
+  std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const thread begin_rank,
+  const thread end_rank )
+{
+  // the only chunk is the one of this rank
+  if ( begin_rank < end_rank )
+  {
+    std::copy( send_buffer.begin(),
+      send_buffer.begin() + send_recv_count_spike_data_per_rank_,
+      recv_buffer.begin() );
+  }
+}
+
 #endif // HAVE_MPI
 
 template < class D >
@@ -830,7 +1353,7 @@ MPIManager::communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std:
   const size_t send_recv_count_spike_data_in_int_per_rank =
     sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
 
-  communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+  communicate_spike_data_( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank, false );
 }
 
 template < class D >
@@ -840,7 +1363,28 @@ MPIManager::communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buf
   const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
     sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
 
-  communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+  communicate_spike_data_( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank, false );
+}
+
+template < class D >
+void
+MPIManager::start_communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_spike_data_( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank, true );
+}
+
+template < class D >
+void
+MPIManager::start_communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_spike_data_( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank, true );
 }
 }
 
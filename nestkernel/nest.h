@@ -62,7 +62,8 @@ enum class RegisterConnectionModelFlags : unsigned
   SUPPORTS_WFR = 1 << 4,
   REQUIRES_SYMMETRIC = 1 << 5,
   REQUIRES_CLOPATH_ARCHIVING = 1 << 6,
-  REQUIRES_URBANCZIK_ARCHIVING = 1 << 7
+  REQUIRES_URBANCZIK_ARCHIVING = 1 << 7,
+  REGISTER_COMPACT = 1 << 8
 };
 
 template <>
@@ -72,12 +73,15 @@ struct EnableBitMaskOperators< RegisterConnectionModelFlags >
 };
 
 const RegisterConnectionModelFlags default_connection_model_flags = RegisterConnectionModelFlags::REGISTER_HPC
-  | RegisterConnectionModelFlags::REGISTER_LBL | RegisterConnectionModelFlags::IS_PRIMARY
-  | RegisterConnectionModelFlags::HAS_DELAY;
+  | RegisterConnectionModelFlags::REGISTER_LBL | RegisterConnectionModelFlags::REGISTER_COMPACT
+  | RegisterConnectionModelFlags::IS_PRIMARY | RegisterConnectionModelFlags::HAS_DELAY;
 
 const RegisterConnectionModelFlags default_secondary_connection_model_flags =
   RegisterConnectionModelFlags::SUPPORTS_WFR | RegisterConnectionModelFlags::HAS_DELAY;
 
+const RegisterConnectionModelFlags default_soa_connection_model_flags = RegisterConnectionModelFlags::REGISTER_HPC
+  | RegisterConnectionModelFlags::IS_PRIMARY | RegisterConnectionModelFlags::HAS_DELAY;
+
 /**
  * Register connection model (i.e. an instance of a class inheriting from `Connection`).
  */
@@ -92,6 +96,21 @@ template < template < typename > class ConnectorModelT >
 void register_secondary_connection_model( const std::string& name,
   const RegisterConnectionModelFlags flags = default_secondary_connection_model_flags );
 
+/**
+ * Register connection model that stores its connections as structure of
+ * arrays (e.g. static synapses, see SoAConnector).
+ */
+template < template < typename > class ConnectorModelT >
+void register_soa_connection_model( const std::string& name,
+  const RegisterConnectionModelFlags flags = default_soa_connection_model_flags );
+
+/**
+ * Deliver spikes through a connection model to targets of node model
+ * TargetT without dynamic dispatch (see ModelManager).
+ */
+template < template < typename > class ConnectorModelT, class TargetT >
+void register_spike_delivery_target( const std::string& name );
+
 void print_nodes_to_stream( std::ostream& out = std::cout );
 
 RngPtr get_rank_synced_rng();
@@ -41,4 +41,18 @@ register_secondary_connection_model( const std::string& name, const RegisterConn
 {
   kernel().model_manager.register_secondary_connection_model< ConnectorModelT >( name, flags );
 }
+
+template < template < typename > class ConnectorModelT >
+void
+register_soa_connection_model( const std::string& name, const RegisterConnectionModelFlags flags )
+{
+  kernel().model_manager.register_soa_connection_model< ConnectorModelT >( name, flags );
+}
+
+template < template < typename > class ConnectorModelT, class TargetT >
+void
+register_spike_delivery_target( const std::string& name )
+{
+  kernel().model_manager.register_spike_delivery_target< ConnectorModelT, TargetT >( name );
+}
 }
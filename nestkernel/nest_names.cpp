@@ -57,6 +57,8 @@ const Name allow_autapses( "allow_autapses" );
 const Name allow_multapses( "allow_multapses" );
 const Name allow_offgrid_times( "allow_offgrid_times" );
 const Name allow_oversized_mask( "allow_oversized_mask" );
+const Name alltoall( "alltoall" );
+const Name alltoallv( "alltoallv" );
 const Name alpha( "alpha" );
 const Name alpha_1( "alpha_1" );
 const Name alpha_2( "alpha_2" );
@@ -73,6 +75,8 @@ const Name available( "available" );
 const Name azimuth_angle( "azimuth_angle" );
 
 const Name b( "b" );
+const Name batched_solver( "batched_solver" );
+const Name batched_spike_delivery( "batched_spike_delivery" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
 const Name biological_time( "biological_time" );
@@ -100,6 +104,7 @@ const Name consistent_integration( "consistent_integration" );
 const Name continuous( "continuous" );
 const Name count_covariance( "count_covariance" );
 const Name count_histogram( "count_histogram" );
+const Name counted_target_data( "counted_target_data" );
 const Name covariance( "covariance" );
 
 const Name Delta_T( "Delta_T" );
@@ -160,6 +165,7 @@ const Name elements( "elements" );
 const Name elementsize( "elementsize" );
 const Name ellipsoidal( "ellipsoidal" );
 const Name elliptical( "elliptical" );
+const Name encode_spike_data( "encode_spike_data" );
 const Name eps( "eps" );
 const Name equilibrate( "equilibrate" );
 const Name eta( "eta" );
@@ -217,6 +223,7 @@ const Name gsl_error_tol( "gsl_error_tol" );
 const Name h( "h" );
 const Name has_connections( "has_connections" );
 const Name has_delay( "has_delay" );
+const Name hierarchical( "hierarchical" );
 const Name histogram( "histogram" );
 const Name histogram_correction( "histogram_correction" );
 
@@ -309,7 +316,9 @@ const Name num_connections( "num_connections" );
 const Name num_processes( "num_processes" );
 const Name number_of_connections( "number_of_connections" );
 
+const Name off_grid_spike_data( "off_grid_spike_data" );
 const Name off_grid_spiking( "off_grid_spiking" );
+const Name offload_spike_delivery( "offload_spike_delivery" );
 const Name offset( "offset" );
 const Name offsets( "offsets" );
 const Name omega( "omega" );
@@ -326,10 +335,13 @@ const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
 const Name pairwise_bernoulli_on_source( "pairwise_bernoulli_on_source" );
 const Name pairwise_bernoulli_on_target( "pairwise_bernoulli_on_target" );
+const Name persistent_mpi_requests( "persistent_mpi_requests" );
 const Name phase( "phase" );
 const Name phi_max( "phi_max" );
+const Name pipelined_spike_exchange( "pipelined_spike_exchange" );
 const Name polar_angle( "polar_angle" );
 const Name polar_axis( "polar_axis" );
+const Name population_update( "population_update" );
 const Name port( "port" );
 const Name port_name( "port_name" );
 const Name port_width( "port_width" );
@@ -353,6 +365,7 @@ const Name q_sfa( "q_sfa" );
 const Name q_stc( "q_stc" );
 
 const Name radius( "radius" );
+const Name ranks_per_node( "ranks_per_node" );
 const Name rate( "rate" );
 const Name rate_slope( "rate_slope" );
 const Name rate_times( "rate_times" );
@@ -388,6 +401,7 @@ const Name S( "S" );
 const Name S_act_NMDA( "S_act_NMDA" );
 const Name sdev( "sdev" );
 const Name send_buffer_size_secondary_events( "send_buffer_size_secondary_events" );
+const Name secondary_events( "secondary_events" );
 const Name senders( "senders" );
 const Name shape( "shape" );
 const Name shift_now_spikes( "shift_now_spikes" );
@@ -403,8 +417,15 @@ const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name sort_connections_by_source( "sort_connections_by_source" );
 const Name source( "source" );
+const Name sparse( "sparse" );
 const Name spherical( "spherical" );
+const Name spike_buffer_history_length( "spike_buffer_history_length" );
+const Name spike_buffer_memory( "spike_buffer_memory" );
+const Name spike_buffer_overflow_rounds( "spike_buffer_overflow_rounds" );
+const Name spike_buffer_quantile( "spike_buffer_quantile" );
+const Name spike_data( "spike_data" );
 const Name spike_dependent_threshold( "spike_dependent_threshold" );
+const Name spike_exchange( "spike_exchange" );
 const Name spike_multiplicities( "spike_multiplicities" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
@@ -438,6 +459,8 @@ const Name t_ref_remaining( "t_ref_remaining" );
 const Name t_ref_tot( "t_ref_tot" );
 const Name t_spike( "t_spike" );
 const Name target( "target" );
+const Name target_data( "target_data" );
+const Name target_data_chunk_size( "target_data_chunk_size" );
 const Name target_thread( "target_thread" );
 const Name targets( "targets" );
 const Name tau( "tau" );
@@ -506,6 +529,7 @@ const Name theta_minus( "theta_minus" );
 const Name theta_plus( "theta_plus" );
 const Name thread( "thread" );
 const Name thread_local_id( "thread_local_id" );
+const Name thread_parallel_spike_exchange( "thread_parallel_spike_exchange" );
 const Name threshold( "threshold" );
 const Name threshold_spike( "threshold_spike" );
 const Name threshold_voltage( "threshold_voltage" );
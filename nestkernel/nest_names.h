@@ -81,6 +81,8 @@ extern const Name allow_autapses;
 extern const Name allow_multapses;
 extern const Name allow_offgrid_times;
 extern const Name allow_oversized_mask;
+extern const Name alltoall;
+extern const Name alltoallv;
 extern const Name alpha;
 extern const Name alpha_1;
 extern const Name alpha_2;
@@ -97,6 +99,8 @@ extern const Name available;
 extern const Name azimuth_angle;
 
 extern const Name b;
+extern const Name batched_solver;
+extern const Name batched_spike_delivery;
 extern const Name beta;
 extern const Name beta_Ca;
 extern const Name biological_time;
@@ -124,6 +128,7 @@ extern const Name consistent_integration;
 extern const Name continuous;
 extern const Name count_covariance;
 extern const Name count_histogram;
+extern const Name counted_target_data;
 extern const Name covariance;
 
 extern const Name Delta_T;
@@ -184,6 +189,7 @@ extern const Name elements;
 extern const Name elementsize;
 extern const Name ellipsoidal;
 extern const Name elliptical;
+extern const Name encode_spike_data;
 extern const Name eps;
 extern const Name equilibrate;
 extern const Name eta;
@@ -241,6 +247,7 @@ extern const Name gsl_error_tol;
 extern const Name h;
 extern const Name has_connections;
 extern const Name has_delay;
+extern const Name hierarchical;
 extern const Name histogram;
 extern const Name histogram_correction;
 
@@ -333,7 +340,9 @@ extern const Name num_connections;
 extern const Name num_processes;
 extern const Name number_of_connections;
 
+extern const Name off_grid_spike_data;
 extern const Name off_grid_spiking;
+extern const Name offload_spike_delivery;
 extern const Name offset;
 extern const Name offsets;
 extern const Name omega;
@@ -350,10 +359,13 @@ extern const Name p_copy;
 extern const Name p_transmit;
 extern const Name pairwise_bernoulli_on_source;
 extern const Name pairwise_bernoulli_on_target;
+extern const Name persistent_mpi_requests;
 extern const Name phase;
 extern const Name phi_max;
+extern const Name pipelined_spike_exchange;
 extern const Name polar_angle;
 extern const Name polar_axis;
+extern const Name population_update;
 extern const Name port;
 extern const Name port_name;
 extern const Name port_width;
@@ -377,6 +389,7 @@ extern const Name q_sfa;
 extern const Name q_stc;
 
 extern const Name radius;
+extern const Name ranks_per_node;
 extern const Name rate;
 extern const Name rate_slope;
 extern const Name rate_times;
@@ -411,6 +424,7 @@ extern const Name rule;
 extern const Name S;
 extern const Name S_act_NMDA;
 extern const Name sdev;
+extern const Name secondary_events;
 extern const Name senders;
 extern const Name send_buffer_size_secondary_events;
 extern const Name shape;
@@ -427,8 +441,15 @@ extern const Name soma_exc;
 extern const Name soma_inh;
 extern const Name sort_connections_by_source;
 extern const Name source;
+extern const Name sparse;
 extern const Name spherical;
+extern const Name spike_buffer_history_length;
+extern const Name spike_buffer_memory;
+extern const Name spike_buffer_overflow_rounds;
+extern const Name spike_buffer_quantile;
+extern const Name spike_data;
 extern const Name spike_dependent_threshold;
+extern const Name spike_exchange;
 extern const Name spike_multiplicities;
 extern const Name spike_times;
 extern const Name spike_weights;
@@ -462,6 +483,8 @@ extern const Name t_ref_remaining;
 extern const Name t_ref_tot;
 extern const Name t_spike;
 extern const Name target;
+extern const Name target_data;
+extern const Name target_data_chunk_size;
 extern const Name target_thread;
 extern const Name targets;
 extern const Name tau;
@@ -530,6 +553,7 @@ extern const Name theta_minus;
 extern const Name theta_plus;
 extern const Name thread;
 extern const Name thread_local_id;
+extern const Name thread_parallel_spike_exchange;
 extern const Name threshold;
 extern const Name threshold_spike;
 extern const Name threshold_voltage;
@@ -93,6 +93,8 @@ constexpr uint8_t NUM_BITS_MARKER_SPIKE_DATA = 2U;
 constexpr uint8_t NUM_BITS_LAG = 14U;
 constexpr uint8_t NUM_BITS_DELAY = 21U;
 constexpr uint8_t NUM_BITS_NODE_ID = 62U;
+constexpr uint8_t NUM_BITS_TARGET_INDEX32 = 24U;
+constexpr uint8_t NUM_BITS_RPORT_INDEX32 = 8U;
 
 /*
  * Maximally allowed values for bitfields
@@ -147,6 +149,11 @@ typedef unsigned short targetindex;
 const targetindex invalid_targetindex = USHRT_MAX;
 __attribute__( ( __unused__ ) ) const index max_targetindex = invalid_targetindex - 1;
 
+//! target index and receiver port sharing 32 bits in compact target representation
+const index invalid_targetindex32 = generate_max_value( NUM_BITS_TARGET_INDEX32 );
+__attribute__( ( __unused__ ) ) const index max_targetindex32 = invalid_targetindex32 - 1;
+const long max_rport_index32 = generate_max_value( NUM_BITS_RPORT_INDEX32 );
+
 /**
  * Thread index type.
  * NEST threads are assigned non-negative numbers for
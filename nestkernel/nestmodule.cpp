@@ -1245,6 +1245,37 @@ NestModule::TimeCommunicationAlltoallv_i_iFunction::execute( SLIInterpreter* i )
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: TimeCommunicationBuffer - returns average time taken for exchanging
+   the MPI buffers used during simulation over n calls with m entries per
+   process
+   Synopsis:
+   n m buffer_type counted TimeCommunicationBuffer -> time
+   Description:
+   The function allows a user to test how much time the exchange of m
+   entries of the given buffer type with each process costs. The
+   buffer type is one of /spike_data, /off_grid_spike_data, /target_data
+   and /secondary_events. If counted is true, the counts are exchanged
+   first and the buffers are exchanged by MPI_Alltoallv, otherwise by
+   MPI_Alltoall.
+   SeeAlso: TimeCommunicationAlltoall, TimeCommunicationAlltoallv
+ */
+void
+NestModule::TimeCommunicationBuffer_i_i_l_bFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 4 );
+  long samples = getValue< long >( i->OStack.pick( 3 ) );
+  long num_entries = getValue< long >( i->OStack.pick( 2 ) );
+  const Name buffer_type = getValue< Name >( i->OStack.pick( 1 ) );
+  bool counted = getValue< bool >( i->OStack.pick( 0 ) );
+
+  double time = kernel().mpi_manager.time_communicate_buffer( buffer_type, counted, num_entries, samples );
+
+  i->OStack.pop( 4 );
+  i->OStack.push( time );
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: ProcessorName - Returns a unique specifier for the actual node.
    Synopsis: ProcessorName -> string
@@ -2971,6 +3002,7 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "TimeCommunicationv_i_i", &timecommunicationv_i_ifunction );
   i->createcommand( "TimeCommunicationAlltoall_i_i", &timecommunicationalltoall_i_ifunction );
   i->createcommand( "TimeCommunicationAlltoallv_i_i", &timecommunicationalltoallv_i_ifunction );
+  i->createcommand( "TimeCommunicationBuffer_i_i_l_b", &timecommunicationbuffer_i_i_l_bfunction );
   i->createcommand( "ProcessorName", &processornamefunction );
 #ifdef HAVE_MPI
   i->createcommand( "MPI_Abort", &mpiabort_ifunction );
@@ -404,6 +404,11 @@ public:
     void execute( SLIInterpreter* ) const;
   } timecommunicationalltoallv_i_ifunction;
 
+  class TimeCommunicationBuffer_i_i_l_bFunction : public SLIFunction
+  {
+    void execute( SLIInterpreter* ) const;
+  } timecommunicationbuffer_i_i_l_bfunction;
+
   class ProcessorNameFunction : public SLIFunction
   {
     void execute( SLIInterpreter* ) const;
@@ -205,6 +205,28 @@ Node::wfr_update( Time const&, const long, const long )
   throw UnexpectedEvent( "Waveform relaxation not supported." );
 }
 
+/**
+ * Default implementations of the population update just
+ * throw UnexpectedEvent
+ */
+void
+Node::init_population( NodeBlock& )
+{
+  throw UnexpectedEvent( "Population update not supported." );
+}
+
+void
+Node::update_population( NodeBlock&, Time const&, const long, const long )
+{
+  throw UnexpectedEvent( "Population update not supported." );
+}
+
+void
+Node::finalize_population( NodeBlock& )
+{
+  throw UnexpectedEvent( "Population update not supported." );
+}
+
 /**
  * Default implementation of check_connection just throws IllegalConnection
  */
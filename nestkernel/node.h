@@ -54,6 +54,7 @@ namespace nest
 class Model;
 class ArchivingNode;
 class TimeConverter;
+struct NodeBlock;
 
 
 /**
@@ -339,6 +340,41 @@ public:
    */
   virtual bool wfr_update( Time const&, const long, const long );
 
+  /**
+   * Returns true if the node can be updated together with the other
+   * nodes of its model on the same thread by update_population(),
+   * which the kernel does if population_update is set.
+   */
+  virtual bool supports_population_update() const;
+
+  /**
+   * Load the state of the nodes of a population into the structure of
+   * arrays of the block before the first update of a run.
+   *
+   * The population functions are called on the first node of the block
+   * and act on all nodes of the block, which are of the model of this
+   * node.
+   *
+   * throws UnexpectedEvent if not reimplemented in derived class
+   */
+  virtual void init_population( NodeBlock& );
+
+  /**
+   * Bring all nodes of a population from state $t$ to $t+n*dt$, like
+   * update() does for a single node.
+   *
+   * throws UnexpectedEvent if not reimplemented in derived class
+   */
+  virtual void update_population( NodeBlock&, Time const&, const long, const long );
+
+  /**
+   * Store the state of the nodes of a population back in the nodes
+   * after the last update of a run.
+   *
+   * throws UnexpectedEvent if not reimplemented in derived class
+   */
+  virtual void finalize_population( NodeBlock& );
+
   /**
    * @defgroup status_interface Configuration interface.
    * Functions and infrastructure, responsible for the configuration
@@ -963,6 +999,12 @@ Node::supports_urbanczik_archiving() const
   return false;
 }
 
+inline bool
+Node::supports_population_update() const
+{
+  return false;
+}
+
 inline void
 Node::set_node_uses_wfr( const bool uwfr )
 {
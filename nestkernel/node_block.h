@@ -0,0 +1,147 @@
+/*
+ *  node_block.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NODE_BLOCK_H
+#define NODE_BLOCK_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+class Node;
+
+/**
+ * Consecutive nodes of one thread that are updated together.
+ *
+ * A block either holds nodes that are updated one by one through
+ * Node::update(), or a population of nodes of the same model, which
+ * are updated by a single call to Node::update_population() on the
+ * first node of the block. During a run, the model keeps the state of
+ * the population in data, as a structure of arrays of one entry per
+ * node, see Node::init_population().
+ */
+struct NodeBlock
+{
+  explicit NodeBlock( const bool population );
+
+  //! Maximal number of nodes of a population, such that its arrays and
+  //! nodes stay in cache while the population is advanced over a slice
+  static const size_t max_population_size = 32;
+
+  //! Returns a pointer to the k-th array of data
+  double* get_array( const size_t k );
+
+  //! Resize data to num_arrays arrays of one entry per node
+  void resize_arrays( const size_t num_arrays );
+
+  std::vector< Node* > nodes; //!< nodes of the block in order of their thread-local ids
+  bool population;            //!< whether the nodes are updated by update_population()
+  std::vector< double > data; //!< state of the population as structure of arrays
+
+  //! Whether all nodes of the population share their parameters, set by
+  //! the model in Node::init_population()
+  bool shared_parameters;
+
+  //! Positions of nodes that are recorded by loggers, which receive the
+  //! state of their node after each step
+  std::vector< index > logged;
+};
+
+inline NodeBlock::NodeBlock( const bool population )
+  : population( population )
+  , shared_parameters( false )
+{
+}
+
+/**
+ * Parameter of a population with one value per node, in an array of
+ * NodeBlock::data.
+ */
+class PerNodeParameter
+{
+public:
+  explicit PerNodeParameter( const double* values );
+
+  double operator[]( const size_t i ) const;
+
+private:
+  const double* const values_;
+};
+
+/**
+ * Parameter that all nodes of a population share, the first value of
+ * an array of NodeBlock::data.
+ *
+ * Updates that read their parameters through this class instead of
+ * PerNodeParameter keep them in registers over the loop over nodes.
+ */
+class SharedParameter
+{
+public:
+  explicit SharedParameter( const double* values );
+
+  double operator[]( const size_t ) const;
+
+private:
+  const double value_;
+};
+
+inline PerNodeParameter::PerNodeParameter( const double* values )
+  : values_( values )
+{
+}
+
+inline double PerNodeParameter::operator[]( const size_t i ) const
+{
+  return values_[ i ];
+}
+
+inline SharedParameter::SharedParameter( const double* values )
+  : value_( values[ 0 ] )
+{
+}
+
+inline double SharedParameter::operator[]( const size_t ) const
+{
+  return value_;
+}
+
+inline double*
+NodeBlock::get_array( const size_t k )
+{
+  return &data[ k * nodes.size() ];
+}
+
+inline void
+NodeBlock::resize_arrays( const size_t num_arrays )
+{
+  data.resize( num_arrays * nodes.size() );
+}
+
+} // namespace nest
+
+#endif /* NODE_BLOCK_H */
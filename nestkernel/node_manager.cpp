@@ -63,14 +63,6 @@ NodeManager::~NodeManager()
                      // to close files.
 }
 
-void
-NodeManager::m2()
-{
-	int len = local_nodes_.size();
-	SparseNodeArray *p = &local_nodes_[0];
-//#pragma omp target enter data map(to: p[0:len])
-}
-
 void
 NodeManager::initialize()
 {
@@ -80,8 +72,6 @@ NodeManager::initialize()
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
   ensure_valid_thread_local_ids();
 
-  std::cout << __PRETTY_FUNCTION__ << " Map this pointer " << this << std::endl;
-#pragma omp target enter data map(to: this[0:1])
   sw_construction_create_.reset();
 }
 
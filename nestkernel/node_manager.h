@@ -106,7 +106,6 @@ public:
    * @see Node::init_state()
    */
   void init_state( index );
-  void m2();
   /**
    * Return total number of network nodes.
    */
@@ -183,7 +182,7 @@ public:
    */
   void ensure_valid_thread_local_ids();
 
-  Node* thread_lid_to_node( thread t, targetindex thread_local_id ) const;
+  Node* thread_lid_to_node( thread t, index thread_local_id ) const;
 
   /**
    * Get list of nodes on given thread.
@@ -322,15 +321,7 @@ private:
   // private stop watch for benchmarking purposes
   Stopwatch sw_construction_create_;
 };
-/*
-void
-NodeManager::m2() 
-{
-int l = local_nodes_.size();
-SparseNodeArray *p = &local_nodes_[0];
-//#pragma omp target enter data map(to: p[0:l])
-}
-*/
+
 inline index
 NodeManager::size() const
 {
@@ -338,7 +329,7 @@ NodeManager::size() const
 }
 
 inline Node*
-NodeManager::thread_lid_to_node( thread t, targetindex thread_local_id ) const
+NodeManager::thread_lid_to_node( thread t, index thread_local_id ) const
 {
   return local_nodes_[ t ].get_node_by_index( thread_local_id );
 }
@@ -58,6 +58,7 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , population_update_( false )
 {
 }
 
@@ -72,9 +73,8 @@ nest::SimulationManager::initialize()
   simulating_ = false;
   simulated_ = false;
   inconsistent_state_ = false;
-
-  std::cout << __PRETTY_FUNCTION__ << " Map this pointer at " << this << std::endl;
-#pragma omp target enter data map(to: this[0:1])
+  population_update_ = false;
+  node_blocks_.clear();
 
   reset_timers_for_preparation();
   reset_timers_for_dynamics();
@@ -392,6 +392,9 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
       wfr_interpolation_order_ = interp_order;
     }
   }
+
+  // takes effect when the simulation is prepared next
+  updateValue< bool >( d, names::population_update, population_update_ );
 }
 
 void
@@ -414,6 +417,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::wfr_tol, wfr_tol_ );
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
+  def< bool >( d, names::population_update, population_update_ );
 
   def< double >( d, names::time_simulate, sw_simulate_.elapsed() );
   def< double >( d, names::time_communicate_prepare, sw_communicate_prepare_.elapsed() );
@@ -456,6 +460,37 @@ nest::SimulationManager::prepare()
   kernel().connection_manager.update_delay_extrema_();
   kernel().event_delivery_manager.init_moduli();
 
+  // pipelined spike exchange delivers spikes one slice late, which is
+  // exact only if no connection is shorter than two slices
+  if ( kernel().event_delivery_manager.get_pipelined_spike_exchange() )
+  {
+    if ( kernel().sp_manager.is_structural_plasticity_enabled() )
+    {
+      throw KernelException( "Pipelined spike exchange cannot be combined with structural plasticity." );
+    }
+    if ( kernel().mpi_manager.get_spike_exchange() == MPIManager::SPIKE_EXCHANGE_ALLTOALLV
+      or kernel().mpi_manager.get_spike_exchange() == MPIManager::SPIKE_EXCHANGE_HIERARCHICAL )
+    {
+      throw KernelException( "Pipelined spike exchange requires spike_exchange \"alltoall\" or \"sparse\"." );
+    }
+    const delay min_connection_delay = kernel().connection_manager.get_min_connection_delay();
+    if ( min_connection_delay < 2 * kernel().connection_manager.get_min_delay() )
+    {
+      throw KernelException( String::compose(
+        "Pipelined spike exchange requires all delays to be at least twice min_delay, but the smallest "
+        "delay is %1 ms. Set min_delay to at most half of it with SetKernelStatus before creating connections.",
+        Time::delay_steps_to_ms( min_connection_delay ) ) );
+    }
+  }
+
+  // encoded chunks have data-dependent sizes, which only the
+  // alltoallv protocol supports
+  if ( kernel().event_delivery_manager.get_encode_spike_data()
+    and kernel().mpi_manager.get_spike_exchange() != MPIManager::SPIKE_EXCHANGE_ALLTOALLV )
+  {
+    throw KernelException( "Encoded spike data requires spike_exchange \"alltoallv\"." );
+  }
+
   // if at the beginning of a simulation, set up spike buffers
   if ( not simulated_ )
   {
@@ -482,6 +517,8 @@ nest::SimulationManager::prepare()
   // it resizes coefficient arrays for secondary events
   kernel().node_manager.check_wfr_use();
 
+  prepare_node_blocks_();
+
   if ( kernel().node_manager.have_nodes_changed() or kernel().connection_manager.have_connections_changed() )
   {
 #pragma omp parallel
@@ -750,6 +787,14 @@ nest::SimulationManager::update_connection_infrastructure( const thread tid )
 
 #pragma omp single
   {
+    // let ranks that exchange spikes sparsely know their neighbours
+    if ( kernel().mpi_manager.get_num_processes() > 1 )
+    {
+      std::vector< int > is_spike_target_rank;
+      kernel().connection_manager.get_spike_target_ranks( is_spike_target_rank );
+      kernel().mpi_manager.set_spike_target_ranks( is_spike_target_rank );
+    }
+
     kernel().node_manager.set_have_nodes_changed( false );
   }
   kernel().connection_manager.unset_have_connections_changed( tid );
@@ -767,6 +812,47 @@ nest::SimulationManager::wfr_update_( Node* n )
   return ( n->wfr_update( clock_, from_step_, to_step_ ) );
 }
 
+void
+nest::SimulationManager::prepare_node_blocks_()
+{
+  node_blocks_.clear();
+  if ( not population_update_ )
+  {
+    return;
+  }
+
+  node_blocks_.resize( kernel().vp_manager.get_num_threads() );
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+    std::vector< NodeBlock >& blocks = node_blocks_[ tid ];
+
+    const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+    for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+    {
+      Node* node = n->get_node();
+      if ( node->is_frozen() )
+      {
+        continue;
+      }
+
+      // Populations only extend over consecutive nodes of one model, such
+      // that in each step spikes are sent in the order of the nodes. They
+      // are limited in size, such that their arrays stay in cache while
+      // they are advanced over a slice.
+      const bool population = node->supports_population_update();
+      if ( blocks.empty() or blocks.back().population != population
+        or ( population
+             and ( blocks.back().nodes.back()->get_model_id() != node->get_model_id()
+                   or blocks.back().nodes.size() == NodeBlock::max_population_size ) ) )
+      {
+        blocks.push_back( NodeBlock( population ) );
+      }
+      blocks.back().nodes.push_back( node );
+    }
+  } // of omp parallel
+}
+
 void
 nest::SimulationManager::update_()
 {
@@ -781,10 +867,26 @@ nest::SimulationManager::update_()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
 
-    kernel().connection_manager.copy_to(tid);
-    kernel().connection_manager.map_connections(tid);
-    kernel().event_delivery_manager.map_1();
-    kernel().node_manager.m2();
+    // load the state of populations into their blocks for this run
+    if ( not node_blocks_.empty() )
+    {
+      try
+      {
+        for ( std::vector< NodeBlock >::iterator b = node_blocks_[ tid ].begin(); b != node_blocks_[ tid ].end(); ++b )
+        {
+          if ( b->population )
+          {
+            b->nodes[ 0 ]->init_population( *b );
+          }
+        }
+      }
+      catch ( std::exception& e )
+      {
+        // so throw the exception after parallel region
+        exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+      }
+    }
+
     do
     {
       if ( print_time_ )
@@ -949,24 +1051,52 @@ nest::SimulationManager::update_()
         sw_update_.start();
       }
 #endif
-      const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
-
-      for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+      if ( node_blocks_.empty() )
       {
-        // We update in a parallel region. Therefore, we need to catch
-        // exceptions here and then handle them after the parallel region.
-        try
+        const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+
+        for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
         {
-          Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          // We update in a parallel region. Therefore, we need to catch
+          // exceptions here and then handle them after the parallel region.
+          try
           {
-            ( node )->update( clock_, from_step_, to_step_ );
+            Node* node = n->get_node();
+            if ( not( node )->is_frozen() )
+            {
+              ( node )->update( clock_, from_step_, to_step_ );
+            }
+          }
+          catch ( std::exception& e )
+          {
+            // so throw the exception after parallel region
+            exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
           }
         }
-        catch ( std::exception& e )
+      }
+      else
+      {
+        for ( std::vector< NodeBlock >::iterator b = node_blocks_[ tid ].begin(); b != node_blocks_[ tid ].end(); ++b )
         {
-          // so throw the exception after parallel region
-          exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+          try
+          {
+            if ( b->population )
+            {
+              b->nodes[ 0 ]->update_population( *b, clock_, from_step_, to_step_ );
+            }
+            else
+            {
+              for ( std::vector< Node* >::iterator n = b->nodes.begin(); n != b->nodes.end(); ++n )
+              {
+                ( *n )->update( clock_, from_step_, to_step_ );
+              }
+            }
+          }
+          catch ( std::exception& e )
+          {
+            // so throw the exception after parallel region
+            exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+          }
         }
       }
 
@@ -1024,6 +1154,21 @@ nest::SimulationManager::update_()
 #pragma omp barrier
     } while ( to_do_ > 0 and not exceptions_raised.at( tid ) );
 
+    // deliver the spikes of the last slice if they are still in flight
+    kernel().event_delivery_manager.complete_pending_spike_data( tid );
+
+    // store the state of populations back in their nodes
+    if ( not node_blocks_.empty() )
+    {
+      for ( std::vector< NodeBlock >::iterator b = node_blocks_[ tid ].begin(); b != node_blocks_[ tid ].end(); ++b )
+      {
+        if ( b->population )
+        {
+          b->nodes[ 0 ]->finalize_population( *b );
+        }
+      }
+    }
+
     // End of the slice, we update the number of synaptic elements
     for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
           i != kernel().node_manager.get_local_nodes( tid ).end();
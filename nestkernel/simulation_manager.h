@@ -36,6 +36,7 @@
 // Includes from nestkernel:
 #include "nest_time.h"
 #include "nest_types.h"
+#include "node_block.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -174,6 +175,13 @@ private:
   void advance_time_();   //!< Update time to next time step
   void print_progress_(); //!< TODO: Remove, replace by logging!
 
+  /**
+   * Group the unfrozen nodes of each thread into blocks, such that
+   * consecutive nodes of a model that supports population update are
+   * updated together. Clears the blocks if population_update_ is not set.
+   */
+  void prepare_node_blocks_();
+
   Time clock_;                     //!< SimulationManager clock, updated once per slice
   delay slice_;                    //!< current update slice
   delay to_do_;                    //!< number of pending cycles.
@@ -200,6 +208,12 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+  bool population_update_;         //!< Whether nodes that support it are updated
+                                   //!< as populations
+
+  //! Blocks of nodes of each thread in update order, empty unless
+  //! population_update_ was set when the simulation was prepared
+  std::vector< std::vector< NodeBlock > > node_blocks_;
 
   // private stop watches for benchmarking purposes
   Stopwatch sw_simulate_;
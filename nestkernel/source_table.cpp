@@ -449,6 +449,49 @@ nest::SourceTable::get_next_target_data( const thread tid,
   }
 }
 
+void
+nest::SourceTable::count_target_data( const thread rank_start,
+  const thread rank_end,
+  std::vector< size_t >& counts ) const
+{
+  // Mirrors the decisions of get_next_target_data(). Entries are read
+  // backwards there, so the previous entry of an entry has not been
+  // processed in the current pass yet and is checked in the same state.
+  for ( size_t tid = 0; tid < sources_.size(); ++tid )
+  {
+    for ( size_t syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
+    {
+      const BlockVector< Source >& local_sources = sources_[ tid ][ syn_id ];
+      for ( size_t lcid = 0; lcid < local_sources.size(); ++lcid )
+      {
+        const Source& source = local_sources[ lcid ];
+        if ( not source_should_be_processed_( rank_start, rank_end, source ) )
+        {
+          continue;
+        }
+
+        // only the first of several entries with the same source is communicated
+        if ( lcid > 0 and not local_sources[ lcid - 1 ].is_processed()
+          and local_sources[ lcid - 1 ].get_node_id() == source.get_node_id() )
+        {
+          continue;
+        }
+
+        // compressed sources are communicated by the thread that holds
+        // them in compressed_spike_data_map_
+        if ( source.is_primary() and kernel().connection_manager.use_compressed_spikes()
+          and compressed_spike_data_map_[ tid ][ syn_id ].find( source.get_node_id() )
+            == compressed_spike_data_map_[ tid ][ syn_id ].end() )
+        {
+          continue;
+        }
+
+        ++counts[ kernel().mpi_manager.get_process_id_of_node_id( source.get_node_id() ) ];
+      }
+    }
+  }
+}
+
 void
 nest::SourceTable::resize_compressible_sources()
 {
@@ -456,7 +499,7 @@ nest::SourceTable::resize_compressible_sources()
   {
     compressible_sources_[ tid ].clear();
     compressible_sources_[ tid ].resize(
-      kernel().model_manager.get_num_synapse_prototypes(), std::map< index, SpikeData >() );
+      kernel().model_manager.get_num_synapse_prototypes(), std::map< index, LcidSpan >() );
   }
 }
 
@@ -470,9 +513,7 @@ nest::SourceTable::collect_compressible_sources( const thread tid )
     while ( lcid < syn_sources.size() )
     {
       const index old_source_node_id = syn_sources[ lcid ].get_node_id();
-      const std::pair< index, SpikeData > source_node_id_to_spike_data =
-        std::make_pair( old_source_node_id, SpikeData( tid, syn_id, lcid, 0 ) );
-      compressible_sources_[ tid ][ syn_id ].insert( source_node_id_to_spike_data );
+      const index begin_lcid = lcid;
 
       // find next source with different node_id (assumes sorted sources)
       ++lcid;
@@ -480,55 +521,72 @@ nest::SourceTable::collect_compressible_sources( const thread tid )
       {
         ++lcid;
       }
+
+      compressible_sources_[ tid ][ syn_id ].insert(
+        std::make_pair( old_source_node_id, LcidSpan( begin_lcid, lcid ) ) );
     }
   }
 }
 
 void
 nest::SourceTable::fill_compressed_spike_data(
-  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data )
+  std::vector< std::vector< std::vector< LcidSpan > > >& compressed_spike_data )
 {
-  compressed_spike_data.clear();
-  compressed_spike_data.resize( kernel().model_manager.get_num_synapse_prototypes() );
+  const thread num_threads = compressible_sources_.size();
+  const synindex num_syn_ids = kernel().model_manager.get_num_synapse_prototypes();
 
-  for ( thread tid = 0; tid < static_cast< thread >( compressible_sources_.size() ); ++tid )
+  compressed_spike_data.clear();
+  compressed_spike_data.resize( num_threads );
+  for ( thread tid = 0; tid < num_threads; ++tid )
   {
+    compressed_spike_data[ tid ].resize( num_syn_ids );
+
     compressed_spike_data_map_[ tid ].clear();
-    compressed_spike_data_map_[ tid ].resize(
-      kernel().model_manager.get_num_synapse_prototypes(), std::map< index, size_t >() );
+    compressed_spike_data_map_[ tid ].resize( num_syn_ids, std::map< index, size_t >() );
   }
 
   // pseudo-random thread selector to balance memory usage across
   // threads of compressed_spike_data_map_
   size_t thread_idx = 0;
 
-  // for each local thread and each synapse type we will populate this
-  // vector with spike data containing information about all process
-  // local targets
-  std::vector< SpikeData > spike_data;
+  // threads which house targets of the current source
+  std::vector< thread > target_tids;
 
-  for ( thread tid = 0; tid < static_cast< thread >( compressible_sources_.size() ); ++tid )
+  for ( thread tid = 0; tid < num_threads; ++tid )
   {
     for ( synindex syn_id = 0; syn_id < compressible_sources_[ tid ].size(); ++syn_id )
     {
       for ( auto it = compressible_sources_[ tid ][ syn_id ].begin();
             it != compressible_sources_[ tid ][ syn_id ].end(); )
       {
-        spike_data.clear();
+        // every source gets an index that is valid on all threads;
+        // threads without targets of this source store an empty span
+        const size_t idx = compressed_spike_data[ tid ][ syn_id ].size();
+        target_tids.clear();
 
-        // add target position on this thread
-        spike_data.push_back( it->second );
+        for ( thread other_tid = 0; other_tid < tid; ++other_tid )
+        {
+          compressed_spike_data[ other_tid ][ syn_id ].push_back( LcidSpan() );
+        }
 
-        // add target positions on all other threads
-        for ( thread other_tid = tid + 1; other_tid < static_cast< thread >( compressible_sources_.size() );
-              ++other_tid )
+        // add target span on this thread
+        compressed_spike_data[ tid ][ syn_id ].push_back( it->second );
+        target_tids.push_back( tid );
+
+        // add target spans on all other threads
+        for ( thread other_tid = tid + 1; other_tid < num_threads; ++other_tid )
         {
           auto other_it = compressible_sources_[ other_tid ][ syn_id ].find( it->first );
           if ( other_it != compressible_sources_[ other_tid ][ syn_id ].end() )
           {
-            spike_data.push_back( other_it->second );
+            compressed_spike_data[ other_tid ][ syn_id ].push_back( other_it->second );
+            target_tids.push_back( other_tid );
             compressible_sources_[ other_tid ][ syn_id ].erase( other_it );
           }
+          else
+          {
+            compressed_spike_data[ other_tid ][ syn_id ].push_back( LcidSpan() );
+          }
         }
 
         // WARNING: store source-node-id -> process-global-synapse
@@ -536,12 +594,10 @@ nest::SourceTable::fill_compressed_spike_data(
         // pseudo-randomly selected thread which houses targets for
         // this source; this tries to balance memory usage of this
         // data structure across threads
-        const thread responsible_tid = spike_data[ thread_idx % spike_data.size() ].get_tid();
+        const thread responsible_tid = target_tids[ thread_idx % target_tids.size() ];
         ++thread_idx;
 
-        compressed_spike_data_map_[ responsible_tid ][ syn_id ].insert(
-          std::make_pair( it->first, compressed_spike_data[ syn_id ].size() ) );
-        compressed_spike_data[ syn_id ].push_back( spike_data );
+        compressed_spike_data_map_[ responsible_tid ][ syn_id ].insert( std::make_pair( it->first, idx ) );
 
         it = compressible_sources_[ tid ][ syn_id ].erase( it );
       }
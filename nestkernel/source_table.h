@@ -48,6 +48,36 @@ namespace nest
 
 class TargetData;
 
+/**
+ * Range [begin, end) of local connection ids (lcids) of all connections
+ * of one source in the connector of one synapse type on one
+ * thread. Requires connections to be sorted by source. Sources without
+ * targets on the thread are represented by an empty span.
+ */
+struct LcidSpan
+{
+  index begin;
+  index end;
+
+  LcidSpan()
+    : begin( invalid_index )
+    , end( invalid_index )
+  {
+  }
+
+  LcidSpan( const index b, const index e )
+    : begin( b )
+    , end( e )
+  {
+  }
+
+  bool
+  empty() const
+  {
+    return begin == end;
+  }
+};
+
 /**
  * This data structure stores the node IDs of presynaptic neurons
  * during postsynaptic connection creation, before the connection
@@ -136,9 +166,9 @@ private:
    * structure of ConnectionManager during construction of the
    * postsynaptic connection infrastructure. Arranged as a two
    * dimensional vector (thread|synapse) with an inner map (source
-   * node id -> spike data).
+   * node id -> lcid span).
    */
-  std::vector< std::vector< std::map< index, SpikeData > > > compressible_sources_;
+  std::vector< std::vector< std::map< index, LcidSpan > > > compressible_sources_;
 
   /**
    * A structure to temporarily store locations of "unpacked spikes"
@@ -188,6 +218,13 @@ public:
     thread& source_rank,
     TargetData& next_target_data );
 
+  /**
+   * Adds the number of target data that get_next_target_data() will
+   * return for each source rank in [rank_start, rank_end) to counts,
+   * without changing the source table.
+   */
+  void count_target_data( const thread rank_start, const thread rank_end, std::vector< size_t >& counts ) const;
+
   /**
    * Rejects the last target data, and resets the current_positions_
    * accordingly.
@@ -301,7 +338,7 @@ public:
   // creates maps of sources with more than one thread-local target
   void collect_compressible_sources( const thread tid );
   // fills the compressed_spike_data structure in ConnectionManager
-  void fill_compressed_spike_data( std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data );
+  void fill_compressed_spike_data( std::vector< std::vector< std::vector< LcidSpan > > >& compressed_spike_data );
 
   void clear_compressed_spike_data_map( const thread tid );
 };
@@ -0,0 +1,233 @@
+/*
+ *  spike_data_encoding.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_DATA_ENCODING_H
+#define SPIKE_DATA_ENCODING_H
+
+// C++ includes:
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+#include "spike_data.h"
+
+namespace nest
+{
+
+/**
+ * Compact wire format for the spike data sent to one rank.
+ *
+ * A chunk of spike data is sorted by thread, synapse type, lag and
+ * local connection index and written as a stream of variable-length
+ * integers (seven bits per byte, the high bit marks continuation): the
+ * number of entries, followed by groups of entries that share thread,
+ * synapse type and lag. Each group starts with a header of thread,
+ * synapse type, lag and number of entries, followed by the difference
+ * of each lcid to the previous one in the group. Off-grid spike data
+ * append the raw offset to each lcid. Streams are padded with zeros to
+ * whole unsigned ints, the unit in which MPI exchanges them.
+ */
+
+//! Number of bytes of a variable-length integer with the given number of bits
+constexpr size_t
+get_max_varint_size( const size_t num_bits )
+{
+  return ( num_bits + 6 ) / 7;
+}
+
+inline void
+write_varint( unsigned char*& pos, unsigned int value )
+{
+  while ( value >= 0x80 )
+  {
+    *pos++ = static_cast< unsigned char >( value | 0x80 );
+    value >>= 7;
+  }
+  *pos++ = static_cast< unsigned char >( value );
+}
+
+inline unsigned int
+read_varint( const unsigned char*& pos )
+{
+  unsigned int value = 0;
+  unsigned int shift = 0;
+  while ( *pos & 0x80 )
+  {
+    value |= static_cast< unsigned int >( *pos++ & 0x7f ) << shift;
+    shift += 7;
+  }
+  value |= static_cast< unsigned int >( *pos++ ) << shift;
+  return value;
+}
+
+inline void
+write_spike_data_offset( unsigned char*&, const SpikeData& )
+{
+}
+
+inline void
+write_spike_data_offset( unsigned char*& pos, const OffGridSpikeData& spike_data )
+{
+  const double offset = spike_data.get_offset();
+  std::memcpy( pos, &offset, sizeof( double ) );
+  pos += sizeof( double );
+}
+
+inline double
+read_spike_data_offset( const unsigned char*&, const SpikeData& )
+{
+  return 0.;
+}
+
+inline double
+read_spike_data_offset( const unsigned char*& pos, const OffGridSpikeData& )
+{
+  double offset;
+  std::memcpy( &offset, pos, sizeof( double ) );
+  pos += sizeof( double );
+  return offset;
+}
+
+//! Key that orders spike data by thread, synapse type, lag and lcid
+inline uint64_t
+get_spike_data_encoding_key( const SpikeData& spike_data )
+{
+  uint64_t key = spike_data.get_tid();
+  key = ( key << NUM_BITS_SYN_ID ) | spike_data.get_syn_id();
+  key = ( key << NUM_BITS_LAG ) | spike_data.get_lag();
+  key = ( key << NUM_BITS_LCID ) | spike_data.get_lcid();
+  return key;
+}
+
+/**
+ * Returns an upper bound of the size (in ints) of the encoding of
+ * num_entries spike data entries, to reserve buffer space before
+ * encoding.
+ */
+template < typename SpikeDataT >
+size_t
+get_max_encoded_spike_data_size( const size_t num_entries )
+{
+  const size_t max_header_size = get_max_varint_size( NUM_BITS_TID ) + get_max_varint_size( NUM_BITS_SYN_ID )
+    + get_max_varint_size( NUM_BITS_LAG ) + get_max_varint_size( 32 );
+  const size_t max_entry_size =
+    max_header_size + get_max_varint_size( NUM_BITS_LCID ) + sizeof( SpikeDataT ) - sizeof( SpikeData );
+  const size_t max_num_bytes = get_max_varint_size( 32 ) + num_entries * max_entry_size;
+  return ( max_num_bytes + sizeof( unsigned int ) - 1 ) / sizeof( unsigned int );
+}
+
+/**
+ * Sorts the spike data in [begin, end) and encodes them to out, which
+ * must provide get_max_encoded_spike_data_size() ints. Returns the
+ * size of the encoding in ints.
+ */
+template < typename SpikeDataT >
+size_t
+encode_spike_data( SpikeDataT* begin, SpikeDataT* end, unsigned int* out )
+{
+  std::sort( begin,
+    end,
+    []( const SpikeDataT& lhs, const SpikeDataT& rhs )
+    {
+      return get_spike_data_encoding_key( lhs ) < get_spike_data_encoding_key( rhs );
+    } );
+
+  unsigned char* const out_begin = reinterpret_cast< unsigned char* >( out );
+  unsigned char* pos = out_begin;
+
+  write_varint( pos, end - begin );
+
+  SpikeDataT* group_begin = begin;
+  while ( group_begin != end )
+  {
+    SpikeDataT* group_end = group_begin + 1;
+    while ( group_end != end and group_end->get_tid() == group_begin->get_tid()
+      and group_end->get_syn_id() == group_begin->get_syn_id() and group_end->get_lag() == group_begin->get_lag() )
+    {
+      ++group_end;
+    }
+
+    write_varint( pos, group_begin->get_tid() );
+    write_varint( pos, group_begin->get_syn_id() );
+    write_varint( pos, group_begin->get_lag() );
+    write_varint( pos, group_end - group_begin );
+
+    index previous_lcid = 0;
+    for ( SpikeDataT* it = group_begin; it != group_end; ++it )
+    {
+      write_varint( pos, it->get_lcid() - previous_lcid );
+      write_spike_data_offset( pos, *it );
+      previous_lcid = it->get_lcid();
+    }
+
+    group_begin = group_end;
+  }
+
+  const size_t size = ( pos - out_begin + sizeof( unsigned int ) - 1 ) / sizeof( unsigned int );
+  std::fill( pos, out_begin + size * sizeof( unsigned int ), 0 );
+  return size;
+}
+
+/**
+ * Returns the number of spike data entries in an encoded chunk.
+ */
+inline size_t
+get_num_encoded_spike_data( const unsigned int* in )
+{
+  const unsigned char* pos = reinterpret_cast< const unsigned char* >( in );
+  return read_varint( pos );
+}
+
+/**
+ * Decodes an encoded chunk to out, which must provide
+ * get_num_encoded_spike_data() entries.
+ */
+template < typename SpikeDataT >
+void
+decode_spike_data( const unsigned int* in, SpikeDataT* out )
+{
+  const unsigned char* pos = reinterpret_cast< const unsigned char* >( in );
+
+  SpikeDataT* const end = out + read_varint( pos );
+  while ( out != end )
+  {
+    const thread tid = read_varint( pos );
+    const synindex syn_id = read_varint( pos );
+    const unsigned int lag = read_varint( pos );
+    const unsigned int group_size = read_varint( pos );
+
+    index lcid = 0;
+    for ( unsigned int i = 0; i < group_size; ++i )
+    {
+      lcid += read_varint( pos );
+      const double offset = read_spike_data_offset( pos, *out );
+      out->set( tid, syn_id, lcid, lag, offset );
+      ++out;
+    }
+  }
+}
+
+} // namespace nest
+
+#endif /* SPIKE_DATA_ENCODING_H */
@@ -0,0 +1,260 @@
+/*
+ *  spike_register.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_REGISTER_H
+#define SPIKE_REGISTER_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Register of the remote targets of all spikes emitted by the nodes of
+ * one thread during one min_delay interval.
+ *
+ * Targets are written by the owning thread only, so appending needs no
+ * synchronization: push_back() appends the target and the number of
+ * its bucket, i.e., of the pair (reading thread, lag), to two flat
+ * arrays. Before spikes are moved to the MPI buffers, freeze() groups
+ * the targets by bucket with a stable counting sort. Afterwards, the
+ * targets that reading thread tid has to send for a given lag are the
+ * contiguous range [begin( tid, lag ), end( tid, lag )), in the order
+ * in which they were registered. clear() only resets the fill level,
+ * so it does not depend on the number of threads or lags.
+ *
+ * TargetT is Target or OffGridTarget.
+ */
+template < typename TargetT >
+class SpikeRegister
+{
+public:
+  typedef typename std::vector< TargetT >::iterator iterator;
+
+  SpikeRegister();
+
+  /**
+   * Set the number of reading threads and lags. Must only be called
+   * on an empty register.
+   */
+  void resize( const thread num_reading_threads, const size_t num_lags );
+
+  size_t get_num_lags() const;
+
+  /**
+   * Register a target that reading thread reading_tid sends for lag.
+   */
+  void push_back( const thread reading_tid, const size_t lag, const TargetT& target );
+
+  /**
+   * Group the registered targets by reading thread and lag. Targets
+   * cannot be added until the register is cleared.
+   */
+  void freeze();
+
+  bool empty() const;
+
+  iterator begin( const thread reading_tid, const size_t lag );
+  iterator end( const thread reading_tid, const size_t lag );
+
+  /**
+   * Remove targets that have been moved to the MPI buffers, such that
+   * they are not considered in the next communication round.
+   */
+  void clean();
+
+  /**
+   * Remove all targets. Keeps the allocated memory.
+   */
+  void clear();
+
+private:
+  size_t get_bucket_( const thread reading_tid, const size_t lag ) const;
+
+  thread num_reading_threads_;
+  size_t num_lags_;
+
+  //! Targets in order of registration before freeze(), grouped by bucket after
+  std::vector< TargetT > targets_;
+  //! Bucket of each entry of targets_ before freeze()
+  std::vector< size_t > buckets_;
+  //! Scratch space for grouping
+  std::vector< TargetT > grouped_targets_;
+
+  //! Position of the first target of each bucket in targets_ after freeze()
+  std::vector< size_t > bucket_begin_;
+  //! Position past the last remaining target of each bucket after freeze()
+  std::vector< size_t > bucket_end_;
+
+  bool is_frozen_;
+};
+
+template < typename TargetT >
+SpikeRegister< TargetT >::SpikeRegister()
+  : num_reading_threads_( 0 )
+  , num_lags_( 0 )
+  , is_frozen_( false )
+{
+}
+
+template < typename TargetT >
+inline void
+SpikeRegister< TargetT >::resize( const thread num_reading_threads, const size_t num_lags )
+{
+  assert( targets_.empty() );
+  num_reading_threads_ = num_reading_threads;
+  num_lags_ = num_lags;
+  bucket_begin_.resize( num_reading_threads_ * num_lags_ + 1 );
+  bucket_end_.resize( num_reading_threads_ * num_lags_ );
+}
+
+template < typename TargetT >
+inline size_t
+SpikeRegister< TargetT >::get_num_lags() const
+{
+  return num_lags_;
+}
+
+template < typename TargetT >
+inline size_t
+SpikeRegister< TargetT >::get_bucket_( const thread reading_tid, const size_t lag ) const
+{
+  assert( reading_tid < num_reading_threads_ );
+  assert( lag < num_lags_ );
+  return reading_tid * num_lags_ + lag;
+}
+
+template < typename TargetT >
+inline void
+SpikeRegister< TargetT >::push_back( const thread reading_tid, const size_t lag, const TargetT& target )
+{
+  assert( not is_frozen_ );
+  targets_.push_back( target );
+  buckets_.push_back( get_bucket_( reading_tid, lag ) );
+}
+
+template < typename TargetT >
+inline void
+SpikeRegister< TargetT >::freeze()
+{
+  assert( not is_frozen_ );
+  is_frozen_ = true;
+
+  // nothing to group; begin() and end() do not look at the offsets of
+  // an empty register
+  if ( targets_.empty() )
+  {
+    return;
+  }
+
+  // count targets per bucket, shifted by one to obtain start positions
+  std::fill( bucket_begin_.begin(), bucket_begin_.end(), 0 );
+  for ( std::vector< size_t >::const_iterator it = buckets_.begin(); it != buckets_.end(); ++it )
+  {
+    ++bucket_begin_[ *it + 1 ];
+  }
+  for ( size_t bucket = 1; bucket < bucket_begin_.size(); ++bucket )
+  {
+    bucket_begin_[ bucket ] += bucket_begin_[ bucket - 1 ];
+  }
+
+  // stable scatter, using bucket_end_ as running write position
+  std::copy( bucket_begin_.begin(), bucket_begin_.end() - 1, bucket_end_.begin() );
+  grouped_targets_.resize( targets_.size() );
+  for ( size_t i = 0; i < targets_.size(); ++i )
+  {
+    grouped_targets_[ bucket_end_[ buckets_[ i ] ]++ ] = targets_[ i ];
+  }
+  targets_.swap( grouped_targets_ );
+  buckets_.clear();
+}
+
+template < typename TargetT >
+inline bool
+SpikeRegister< TargetT >::empty() const
+{
+  return targets_.empty();
+}
+
+template < typename TargetT >
+inline typename SpikeRegister< TargetT >::iterator
+SpikeRegister< TargetT >::begin( const thread reading_tid, const size_t lag )
+{
+  assert( is_frozen_ );
+  if ( targets_.empty() )
+  {
+    return targets_.end();
+  }
+  return targets_.begin() + bucket_begin_[ get_bucket_( reading_tid, lag ) ];
+}
+
+template < typename TargetT >
+inline typename SpikeRegister< TargetT >::iterator
+SpikeRegister< TargetT >::end( const thread reading_tid, const size_t lag )
+{
+  assert( is_frozen_ );
+  if ( targets_.empty() )
+  {
+    return targets_.end();
+  }
+  return targets_.begin() + bucket_end_[ get_bucket_( reading_tid, lag ) ];
+}
+
+template < typename TargetT >
+inline void
+SpikeRegister< TargetT >::clean()
+{
+  assert( is_frozen_ );
+  if ( targets_.empty() )
+  {
+    return;
+  }
+
+  // compact each bucket in place; bucket_begin_ stays valid
+  for ( size_t bucket = 0; bucket < bucket_end_.size(); ++bucket )
+  {
+    const iterator first = targets_.begin() + bucket_begin_[ bucket ];
+    const iterator last = targets_.begin() + bucket_end_[ bucket ];
+    const iterator new_last =
+      std::remove_if( first, last, []( const TargetT& target ) { return target.is_processed(); } );
+    bucket_end_[ bucket ] = new_last - targets_.begin();
+  }
+}
+
+template < typename TargetT >
+inline void
+SpikeRegister< TargetT >::clear()
+{
+  targets_.clear();
+  buckets_.clear();
+  is_frozen_ = false;
+}
+
+} // namespace nest
+
+#endif /* SPIKE_REGISTER_H */
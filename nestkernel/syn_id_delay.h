@@ -37,6 +37,11 @@ struct SynIdDelay
   bool more_targets : 1;
   bool disabled : 1;
 
+  SynIdDelay()
+    : SynIdDelay( 1.0 )
+  {
+  }
+
   explicit SynIdDelay( double d )
     : syn_id( invalid_synindex )
     , more_targets( false )
@@ -30,6 +30,7 @@
 
 #include "kernel_manager.h"
 #include "compose.hpp"
+#include "static_assert.h"
 
 namespace nest
 {
@@ -179,6 +180,89 @@ TargetIdentifierIndex::set_target( Node* target )
   target_ = target_lid;
 }
 
+/**
+ * Class providing compact target identified by index and rport.
+ *
+ * This class represents a connection target using a thread-local index
+ * and an rport, which share 32 bits. Connection classes with this class
+ * as template argument provide "compact" synapses, which in contrast to
+ * "hpc" synapses support receptor types, while requiring half the memory
+ * of the target information of "full" synapses.
+ */
+class TargetIdentifierIndex32
+{
+
+public:
+  TargetIdentifierIndex32()
+    : target_( invalid_targetindex32 )
+    , rport_( 0 )
+  {
+  }
+
+
+  TargetIdentifierIndex32( const TargetIdentifierIndex32& t ) = default;
+
+
+  void
+  get_status( DictionaryDatum& d ) const
+  {
+    // Do nothing if called on synapse prototype
+    if ( target_ != invalid_targetindex32 )
+    {
+      def< long >( d, names::rport, rport_ );
+      def< long >( d, names::target, target_ );
+    }
+  }
+
+  Node*
+  get_target_ptr( const thread tid ) const
+  {
+    assert( target_ != invalid_targetindex32 );
+    return kernel().node_manager.thread_lid_to_node( tid, target_ );
+  }
+
+  rport
+  get_rport() const
+  {
+    return rport_;
+  }
+
+  void set_target( Node* target );
+
+  void set_rport( rport rprt );
+
+private:
+  unsigned int target_ : NUM_BITS_TARGET_INDEX32; //!< Target node
+  unsigned int rport_ : NUM_BITS_RPORT_INDEX32;   //!< Receiver port at the target node
+};
+
+//! check legal size
+using success_target_identifier_index32_size = StaticAssert< sizeof( TargetIdentifierIndex32 ) == 4 >::success;
+
+inline void
+TargetIdentifierIndex32::set_target( Node* target )
+{
+  kernel().node_manager.ensure_valid_thread_local_ids();
+
+  index target_lid = target->get_thread_lid();
+  if ( target_lid > max_targetindex32 )
+  {
+    throw IllegalConnection(
+      String::compose( "Compact synapses support at most %1 nodes per thread.", max_targetindex32 ) );
+  }
+  target_ = target_lid;
+}
+
+inline void
+TargetIdentifierIndex32::set_rport( rport rprt )
+{
+  if ( rprt < 0 or rprt > max_rport_index32 )
+  {
+    throw IllegalConnection( String::compose(
+      "Compact synapses support receptor types up to %1. Use normal synapse models instead.", max_rport_index32 ) );
+  }
+  rport_ = rprt;
+}
 
 } // namespace nest
 
@@ -83,6 +83,18 @@ nest::TargetTable::compress_secondary_send_buffer_pos( const thread tid )
   }
 }
 
+void
+nest::TargetTable::mark_target_ranks( const thread tid, std::vector< int >& is_target_rank ) const
+{
+  for ( auto lid_it = targets_[ tid ].cbegin(); lid_it != targets_[ tid ].cend(); ++lid_it )
+  {
+    for ( auto it = lid_it->cbegin(); it != lid_it->cend(); ++it )
+    {
+      is_target_rank[ it->get_rank() ] = 1;
+    }
+  }
+}
+
 void
 nest::TargetTable::add_target( const thread tid, const thread target_rank, const TargetData& target_data )
 {
@@ -92,6 +92,12 @@ public:
    */
   const std::vector< Target >& get_targets( const thread tid, const index lid ) const;
 
+  /**
+   * Sets is_target_rank[ r ] to 1 for all ranks r that host targets of
+   * neurons on thread tid.
+   */
+  void mark_target_ranks( const thread tid, std::vector< int >& is_target_rank ) const;
+
   /**
    * Returns all MPI send buffer positions of a neuron. Used to fill
    * MPI buffer in EventDeliveryManager.
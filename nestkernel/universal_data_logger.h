@@ -154,6 +154,9 @@ public:
    */
   void record_data( long );
 
+  //! Returns whether any recording device is connected
+  bool has_loggers() const;
+
   //! Erase all existing data
   void reset();
 
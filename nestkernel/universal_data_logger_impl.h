@@ -273,6 +273,13 @@ nest::UniversalDataLogger< HostNode >::record_data( long step )
   }
 }
 
+template < typename HostNode >
+bool
+nest::UniversalDataLogger< HostNode >::has_loggers() const
+{
+  return not data_loggers_.empty();
+}
+
 template < typename HostNode >
 void
 nest::UniversalDataLogger< HostNode >::handle( const DataLoggingRequest& dlr )
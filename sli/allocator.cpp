@@ -168,8 +168,7 @@ PoorMansAllocator::new_chunk()
   // We store the head pointer as char*, because sizeof(char) = 1, so
   // that we can add sizeof(object) to advance the pointer to the next
   // free location.
-  //head_ = reinterpret_cast< char* >( malloc( chunk_size_ ) );
-  head_ = (char*)llvm_omp_target_alloc_shared(chunk_size_, 0);
+  head_ = allocate_chunk( chunk_size_ );
   chunks_ = new chunk( head_, chunks_ );
   capacity_ = chunk_size_;
 }
@@ -179,8 +178,7 @@ PoorMansAllocator::destruct()
 {
   for ( chunk* chunks = chunks_; chunks != 0; chunks = chunks->next_ )
   {
-    //free( chunks->mem_ );
-    omp_target_free(chunks->mem_, 0);
+    free_chunk( chunks->mem_ );
   }
   init( chunk_size_ );
 }
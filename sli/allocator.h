@@ -30,15 +30,47 @@
 #include <cassert>
 #include <cstdlib>
 #include <string>
+
+#if defined( HAVE_OFFLOAD ) && defined( __clang__ )
 #include <omp.h>
 
 extern "C" {
-void *llvm_omp_target_alloc_shared(size_t, int);
+void* llvm_omp_target_alloc_shared( size_t, int );
 }
+#endif
 
 namespace sli
 {
 
+/**
+ * Allocate a chunk of memory for the allocators below. With offloading
+ * in clang builds, chunks are allocated as memory shared with the
+ * default device, such that objects in them can be accessed in target
+ * regions. Otherwise, chunks are allocated on the host.
+ */
+inline char*
+allocate_chunk( const size_t size )
+{
+#if defined( HAVE_OFFLOAD ) && defined( __clang__ )
+  return static_cast< char* >( llvm_omp_target_alloc_shared( size, omp_get_default_device() ) );
+#else
+  return static_cast< char* >( std::malloc( size ) );
+#endif
+}
+
+/**
+ * Free a chunk of memory obtained from allocate_chunk().
+ */
+inline void
+free_chunk( char* mem )
+{
+#if defined( HAVE_OFFLOAD ) && defined( __clang__ )
+  omp_target_free( mem, omp_get_default_device() );
+#else
+  std::free( mem );
+#endif
+}
+
 /**
  * @addtogroup MemoryManagement Memory management
  * Classes which are involved in Memory management.
@@ -78,15 +110,13 @@ class pool
     chunk( size_t s )
       : csize( s )
       , next( 0 )
-      //, mem( new char[ csize ] )
+      , mem( allocate_chunk( csize ) )
     {
-      mem = (char*)llvm_omp_target_alloc_shared(csize * sizeof(char), 0);
     }
 
     ~chunk()
     {
-      //delete[] mem;
-      omp_target_free(mem, 0);
+      free_chunk( mem );
       mem = NULL;
     }
 
@@ -238,6 +238,7 @@ SLIStartup::SLIStartup( int argc, char** argv )
   , have_recordingbackend_arbor_name( "have_recordingbackend_arbor" )
   , have_libneurosim_name( "have_libneurosim" )
   , have_sionlib_name( "have_sionlib" )
+  , have_offload_name( "have_offload" )
   , ndebug_name( "ndebug" )
   , exitcodes_name( "exitcodes" )
   , exitcode_success_name( "success" )
@@ -449,6 +450,12 @@ SLIStartup::init( SLIInterpreter* i )
   statusdict->insert( have_sionlib_name, Token( new BoolDatum( false ) ) );
 #endif
 
+#ifdef HAVE_OFFLOAD
+  statusdict->insert( have_offload_name, Token( new BoolDatum( true ) ) );
+#else
+  statusdict->insert( have_offload_name, Token( new BoolDatum( false ) ) );
+#endif
+
 #ifdef NDEBUG
   statusdict->insert( ndebug_name, Token( new BoolDatum( true ) ) );
 #else
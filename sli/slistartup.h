@@ -111,6 +111,7 @@ public:
   Name have_recordingbackend_arbor_name;
   Name have_libneurosim_name;
   Name have_sionlib_name;
+  Name have_offload_name;
   Name ndebug_name;
 
   Name exitcodes_name;